@@ -15,6 +15,7 @@ set(CONFIG_USE_driver_dac_1 true)
 set(CONFIG_USE_driver_dac14 true)
 set(CONFIG_USE_driver_lpcmp true)
 set(CONFIG_USE_driver_lptmr true)
+set(CONFIG_USE_driver_ostimer true)
 set(CONFIG_USE_driver_opamp true)
 set(CONFIG_USE_driver_reset true)
 set(CONFIG_USE_driver_mcx_vbat true)
@@ -27,6 +28,8 @@ set(CONFIG_USE_driver_port true)
 set(CONFIG_USE_component_lpuart_adapter true)
 set(CONFIG_USE_component_lists true)
 set(CONFIG_USE_component_power_manager true)
+set(CONFIG_USE_component_power_manager_lptmr true)
+set(CONFIG_USE_component_power_manager_ostimer true)
 set(CONFIG_USE_utilities_misc_utilities false)
 set(CONFIG_USE_driver_mcx_spc true)
 set(CONFIG_USE_CMSIS_Include_core_cm true)
@@ -322,6 +322,14 @@ void APP_PrintPowerModeToEnter(uint64_t duration)
             PRINTF(", because a power-mode constraint limits to this mode.\r\n");
             break;
 
+        case kPM_reason_latency_qos:
+            PRINTF(", because a wakeup latency request rules out deeper power modes.\r\n");
+            break;
+
+        case kPM_reason_governor:
+            PRINTF(", because the power policy prefers it to deeper power modes.\r\n");
+            break;
+
         case kPM_reason_resc:
             PRINTF(", because resc %s is set, and limits to this mode.\r\n", 
                         resc_strings[results.resc_num]);
@@ -101,6 +101,7 @@ int main(void)
     BOARD_InitDebugConsole();
 
     APP_OptimizePower();
+    APP_InitLptmr();
 
     /* Check if waking from Deep Power Down mode */
     resetSrc = APP_GetResetSource();
@@ -1021,7 +1022,15 @@ void APP_InitSystemSRAM (app_power_config_t *pwr)
 void APP_InitWakeupSource(void)
 {
     PM_InitWakeupSource(&g_lptmr0WakeupSource, PM_WSID_LPTMR0, APP_Lptmr0WakeupService, true);
-    PM_RegisterTimerController(&g_pmHndle, APP_StartLptmr, APP_StopLptmr, NULL, NULL);
+
+    /* The OSTIMER counts clk_16k[2] of the WAKE domain, it keeps the timestamps running in the low power states. */
+    CLOCK_SetupClk16KClocking(kCLOCK_Clk16KToWake);     /* Enable clk_16k[2] for OSTIMER */
+    CLOCK_AttachClk(kCLK_16K2_to_OSTIMER);
+    PM_OstimerInit(OSTIMER0, CLOCK_GetOstimerClkFreq());
+
+    PM_RegisterTimerController(&g_pmHndle, PM_LptmrStart, PM_LptmrStop, PM_OstimerGetTimestamp, PM_OstimerGetDuration);
+    PM_RegisterTimerRearm(&g_pmHndle, PM_LptmrRearm);
+    PM_RegisterTimeBase(&g_pmHndle, &g_lptmrTimeBase);
 }
 
 /*******************************************************************************
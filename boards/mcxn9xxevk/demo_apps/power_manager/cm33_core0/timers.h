@@ -9,6 +9,8 @@
 
 #include "fsl_common.h"
 #include "fsl_pm_core.h"
+#include "fsl_pm_lptmr.h"
+#include "fsl_pm_ostimer.h"
 
 /*******************************************************************************
  * Definitions
@@ -22,9 +24,9 @@
  * Prototypes
  ******************************************************************************/
 extern AT_ALWAYS_ON_DATA(pm_wakeup_source_t g_lptmr0WakeupSource);
+extern const pm_time_base_t g_lptmrTimeBase;
 
+void APP_InitLptmr(void);
 void APP_Lptmr0WakeupService(void);
-void APP_StartLptmr(uint64_t timeOutTickes);
-void APP_StopLptmr(void);
 
 #endif //_TIMERS_H_
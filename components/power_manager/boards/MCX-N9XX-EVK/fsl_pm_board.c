@@ -93,6 +93,26 @@ AT_ALWAYS_ON_DATA_INIT(cmc_power_domain_config_t g_mainWakePDConfig) = {
  *  |----------------|-------------|------------|------------|------------|------------|------------|
  */
 
+#if (defined(FSL_PM_SUPPORT_RESOURCE_DEPENDENCY) && FSL_PM_SUPPORT_RESOURCE_DEPENDENCY)
+#define PM_RESC_DEPENDENCY(deps)                                     \
+    {                                                                \
+        .rescMask = {(uint32_t)(deps), (uint32_t)((deps) >> 32U) } \
+    }
+
+/* Closure masks of PM_RESC_DEPS_xxx, indexed by resource */
+static const pm_resc_mask_t s_rescDependency[PM_CONSTRAINT_COUNT] = {
+    [kResc_Flash] = PM_RESC_DEPENDENCY(PM_RESC_DEPS_FLASH),
+    [kResc_PLL0]  = PM_RESC_DEPENDENCY(PM_RESC_DEPS_PLL0),
+    [kResc_PLL1]  = PM_RESC_DEPENDENCY(PM_RESC_DEPS_PLL1),
+    [kResc_DAC0]  = PM_RESC_DEPENDENCY(PM_RESC_DEPS_DAC),
+    [kResc_DAC1]  = PM_RESC_DEPENDENCY(PM_RESC_DEPS_DAC),
+    [kResc_DAC2]  = PM_RESC_DEPENDENCY(PM_RESC_DEPS_DAC),
+    [kResc_CMP0]  = PM_RESC_DEPENDENCY(PM_RESC_DEPS_CMP),
+    [kResc_CMP1]  = PM_RESC_DEPENDENCY(PM_RESC_DEPS_CMP),
+    [kResc_CMP2]  = PM_RESC_DEPENDENCY(PM_RESC_DEPS_CMP),
+};
+#endif /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
+
 // ToDo Update all Exit Latencies to match datasheet
 
 const pm_device_option_t g_devicePMOption = {
@@ -189,6 +209,10 @@ const pm_device_option_t g_devicePMOption = {
     .manageWakeupSource = ManageWakeupSource,
     .isWakeupSource     = IsWakeupSource,
 #endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
+
+#if (defined(FSL_PM_SUPPORT_RESOURCE_DEPENDENCY) && FSL_PM_SUPPORT_RESOURCE_DEPENDENCY)
+    .rescDependency = s_rescDependency,
+#endif /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
 };
 
 struct _resource_recode
@@ -262,6 +262,34 @@ typedef enum _resc_name
 #define PM_RESC_IO_DET_ON    PM_ENCODE_RESC(PM_RESOURCE_FULL_ON, kResc_IO_Det)
 /* @} */
 
+#if (defined(FSL_PM_SUPPORT_RESOURCE_DEPENDENCY) && FSL_PM_SUPPORT_RESOURCE_DEPENDENCY)
+/*!
+ * @name Resource dependencies
+ * PM_RESC_DEPS_xxx lists the resources needed by a resource constrained fully on. Each entry ORs the prerequisites of
+ * its prerequisites, so the table is the transitive closure of the dependency graph and is resolved at compile time.
+ * Partial on operate modes, such as the Flash low power mode, do not take any prerequisite.
+ * @{
+ */
+#define PM_RESC_DEP(rescIndex) (1ULL << (rescIndex))
+
+#define PM_RESC_DEPS_BUS_SYS_CLK (0ULL)
+#define PM_RESC_DEPS_FRO_144M    (0ULL)
+#define PM_RESC_DEPS_FRO_12M     (0ULL)
+#define PM_RESC_DEPS_OSC_SYS     (0ULL)
+#define PM_RESC_DEPS_VREF        (0ULL)
+
+/* Flash active mode needs the bus clock, the low power mode does not */
+#define PM_RESC_DEPS_FLASH (PM_RESC_DEP(kResc_BUS_SYS_Clk) | PM_RESC_DEPS_BUS_SYS_CLK)
+/* PLL0 is sourced by FRO_HF and PLL1 by OSC_SYS in the board clock configurations */
+#define PM_RESC_DEPS_PLL0  (PM_RESC_DEP(kResc_FRO_144M) | PM_RESC_DEPS_FRO_144M)
+#define PM_RESC_DEPS_PLL1  (PM_RESC_DEP(kResc_OSC_SYS) | PM_RESC_DEPS_OSC_SYS)
+/* CMP functional clocks are attached to FRO_12M */
+#define PM_RESC_DEPS_CMP   (PM_RESC_DEP(kResc_FRO_12M) | PM_RESC_DEPS_FRO_12M)
+/* DAC clocks are attached to FRO_12M, and DACs are referenced to VREF */
+#define PM_RESC_DEPS_DAC   (PM_RESC_DEP(kResc_FRO_12M) | PM_RESC_DEP(kResc_VREF) | PM_RESC_DEPS_FRO_12M | PM_RESC_DEPS_VREF)
+/*! @} */
+#endif /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
+
 #if FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER
 
 /*!
@@ -13,6 +13,7 @@
 #define FSL_PM_SUPPORT_NOTIFICATION          (1U)
 #define FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER (1U)
 #define FSL_PM_SUPPORT_LP_TIMER_CONTROLLER   (1U)
+#define FSL_PM_SUPPORT_TIME_BASE             (1U)
 
 #define PM_CONSTRAINT_COUNT (kResc_Max_Num)
 #define PM_LP_STATE_COUNT   (6U)
@@ -0,0 +1,16 @@
+# Add set(CONFIG_USE_component_power_manager_cpp true) in config.cmake to use this component
+
+include_guard(GLOBAL)
+message("${CMAKE_CURRENT_LIST_FILE} component is included.")
+
+if(CONFIG_USE_component_power_manager)
+
+target_include_directories(${MCUX_SDK_PROJECT_NAME} PUBLIC
+  ${CMAKE_CURRENT_LIST_DIR}/cpp
+)
+
+else()
+
+message(SEND_ERROR "component_power_manager_cpp.MCXN947 dependency does not meet, please check ${CMAKE_CURRENT_LIST_FILE}.")
+
+endif()
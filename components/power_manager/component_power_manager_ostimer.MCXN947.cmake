@@ -0,0 +1,20 @@
+# Add set(CONFIG_USE_component_power_manager_ostimer true) in config.cmake to use this component
+
+include_guard(GLOBAL)
+message("${CMAKE_CURRENT_LIST_FILE} component is included.")
+
+if(CONFIG_USE_component_power_manager AND CONFIG_USE_driver_ostimer)
+
+target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
+  ${CMAKE_CURRENT_LIST_DIR}/timers/fsl_pm_ostimer.c
+)
+
+target_include_directories(${MCUX_SDK_PROJECT_NAME} PUBLIC
+  ${CMAKE_CURRENT_LIST_DIR}/timers
+)
+
+else()
+
+message(SEND_ERROR "component_power_manager_ostimer.MCXN947 dependency does not meet, please check ${CMAKE_CURRENT_LIST_FILE}.")
+
+endif()
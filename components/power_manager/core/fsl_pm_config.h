@@ -21,6 +21,197 @@
 #define FSL_PM_SUPPORT_LP_TIMER_CONTROLLER (0)
 #endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
 
+/*!
+ * @brief If set to 1, clients can register maximum wakeup latency requests with PM_AddLatencyRequest(), the policy
+ * then excludes the power states whose exit latency exceeds the smallest active request.
+ */
+#ifndef FSL_PM_SUPPORT_LATENCY_QOS
+#define FSL_PM_SUPPORT_LATENCY_QOS (0)
+#endif /* FSL_PM_SUPPORT_LATENCY_QOS */
+
+/*!
+ * @brief If set to 1, resource constraints can be released with a grace period (autosuspend delay) through the
+ * pm_timed_constraint_t API. This feature relies on the timestamp and duration functions of the LP timer controller.
+ */
+#ifndef FSL_PM_SUPPORT_TIMED_CONSTRAINTS
+#define FSL_PM_SUPPORT_TIMED_CONSTRAINTS (0)
+#endif /* FSL_PM_SUPPORT_TIMED_CONSTRAINTS */
+
+#if (FSL_PM_SUPPORT_TIMED_CONSTRAINTS && !FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
+#error FSL_PM_SUPPORT_TIMED_CONSTRAINTS requires FSL_PM_SUPPORT_LP_TIMER_CONTROLLER.
+#endif
+
+/*!
+ * @brief If set to 1, setting a resource constraint fully on also sets the constraints of the resources it depends on,
+ * and releasing it releases them. The dependencies are provided by the board through the rescDependency table of
+ * pm_device_option_t.
+ */
+#ifndef FSL_PM_SUPPORT_RESOURCE_DEPENDENCY
+#define FSL_PM_SUPPORT_RESOURCE_DEPENDENCY (0)
+#endif /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
+
+/*!
+ * @brief If set to 1, the entry and exit callbacks of each notifier are timed in CPU cycles, and the exit latency
+ * budget declared by each notifier is added to the exit latency of the power states.
+ */
+#ifndef FSL_PM_SUPPORT_NOTIFY_TIMING
+#define FSL_PM_SUPPORT_NOTIFY_TIMING (0)
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+
+#if (FSL_PM_SUPPORT_NOTIFY_TIMING && !FSL_PM_SUPPORT_NOTIFICATION)
+#error FSL_PM_SUPPORT_NOTIFY_TIMING requires FSL_PM_SUPPORT_NOTIFICATION.
+#endif
+
+/*!
+ * @brief If set to 1, each notifier declares the power states it is called for in its stateMask, the other
+ * notifiers are skipped with a single bit test.
+ */
+#ifndef FSL_PM_SUPPORT_NOTIFY_STATE_MASK
+#define FSL_PM_SUPPORT_NOTIFY_STATE_MASK (0)
+#endif /* FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+
+#if (FSL_PM_SUPPORT_NOTIFY_STATE_MASK && !FSL_PM_SUPPORT_NOTIFICATION)
+#error FSL_PM_SUPPORT_NOTIFY_STATE_MASK requires FSL_PM_SUPPORT_NOTIFICATION.
+#endif
+
+/*!
+ * @brief If set to 1, the exit callback of the notifiers marked with deferExit is not called before
+ * PM_EnterLowPower() returns, but later by PM_RunDeferredNotify() or PM_RunDeferredNotifyElement().
+ */
+#ifndef FSL_PM_SUPPORT_DEFERRED_NOTIFY
+#define FSL_PM_SUPPORT_DEFERRED_NOTIFY (0)
+#endif /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
+
+#if (FSL_PM_SUPPORT_DEFERRED_NOTIFY && !FSL_PM_SUPPORT_NOTIFICATION)
+#error FSL_PM_SUPPORT_DEFERRED_NOTIFY requires FSL_PM_SUPPORT_NOTIFICATION.
+#endif
+
+/*!
+ * @brief If set to 1, an entry notifier can return PM_NOTIFY_FALLBACK() to veto the target power state but tolerate
+ * a shallower one. The power manager then enters that state instead of aborting the low power entry.
+ */
+#ifndef FSL_PM_SUPPORT_NOTIFY_FALLBACK
+#define FSL_PM_SUPPORT_NOTIFY_FALLBACK (0)
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK */
+
+#if (FSL_PM_SUPPORT_NOTIFY_FALLBACK && !FSL_PM_SUPPORT_NOTIFICATION)
+#error FSL_PM_SUPPORT_NOTIFY_FALLBACK requires FSL_PM_SUPPORT_NOTIFICATION.
+#endif
+
+/*!
+ * @brief If set to 1, the notifiers of a group are sorted by the priority member of their notify element instead of
+ * the registration order.
+ */
+#ifndef FSL_PM_SUPPORT_NOTIFY_PRIORITY
+#define FSL_PM_SUPPORT_NOTIFY_PRIORITY (0)
+#endif /* FSL_PM_SUPPORT_NOTIFY_PRIORITY */
+
+#if (FSL_PM_SUPPORT_NOTIFY_PRIORITY && !FSL_PM_SUPPORT_NOTIFICATION)
+#error FSL_PM_SUPPORT_NOTIFY_PRIORITY requires FSL_PM_SUPPORT_NOTIFICATION.
+#endif
+
+/*!
+ * @brief If set to 1, the notifiers and the wakeup sources are not registered at runtime into linked lists, but
+ * defined with PM_NOTIFY_DEFINE() and PM_WAKEUP_SOURCE_DEFINE(). The linker collects them into contiguous tables,
+ * see the linker script requirements in the README.
+ */
+#ifndef FSL_PM_SUPPORT_STATIC_TABLES
+#define FSL_PM_SUPPORT_STATIC_TABLES (0)
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+
+/*!
+ * @brief Cycle counter used to time the notifiers, and its initialization.
+ */
+#ifndef PM_GET_CYCLE_COUNT
+#define PM_GET_CYCLE_COUNT()      MSDK_GetCpuCycleCount()
+#define PM_ENABLE_CYCLE_COUNTER() MSDK_EnableCpuCycleCounter()
+#endif /* PM_GET_CYCLE_COUNT */
+
+/*!
+ * @brief Number of cycles per us, used to check the notifier exit time against its budget.
+ */
+#ifndef PM_CYCLES_PER_US
+#define PM_CYCLES_PER_US() (SystemCoreClock / 1000000UL)
+#endif /* PM_CYCLES_PER_US */
+
+/*!
+ * @brief If set to 1, the exit latency of the power states can be measured at runtime with
+ * PM_RequestLatencyCalibration(), or set with PM_SetSoftwareExitLatency(). The policy then uses these values plus
+ * PM_LATENCY_CALIBRATION_MARGIN instead of the board values. The calibration period is given to the low power timer
+ * in microseconds: without FSL_PM_SUPPORT_TIME_BASE, the low power timer must count microseconds.
+ */
+#ifndef FSL_PM_SUPPORT_LATENCY_CALIBRATION
+#define FSL_PM_SUPPORT_LATENCY_CALIBRATION (0)
+#endif /* FSL_PM_SUPPORT_LATENCY_CALIBRATION */
+
+#if (FSL_PM_SUPPORT_LATENCY_CALIBRATION && !FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
+#error FSL_PM_SUPPORT_LATENCY_CALIBRATION requires FSL_PM_SUPPORT_LP_TIMER_CONTROLLER.
+#endif
+
+/*!
+ * @brief Low power period used to measure the exit latency, in us. It is shortened to fit in the duration of the low
+ * power entry.
+ */
+#ifndef PM_LATENCY_CALIBRATION_DURATION
+#define PM_LATENCY_CALIBRATION_DURATION (1000U)
+#endif /* PM_LATENCY_CALIBRATION_DURATION */
+
+/*!
+ * @brief Number of calibration periods ended early by another wakeup source after which a calibration request is
+ * dropped. Each of them shortens a low power entry to the calibration period.
+ */
+#ifndef PM_LATENCY_CALIBRATION_MAX_ATTEMPTS
+#define PM_LATENCY_CALIBRATION_MAX_ATTEMPTS (8U)
+#endif /* PM_LATENCY_CALIBRATION_MAX_ATTEMPTS */
+
+/*!
+ * @brief Margin added to the measured exit latencies, in us.
+ */
+#ifndef PM_LATENCY_CALIBRATION_MARGIN
+#define PM_LATENCY_CALIBRATION_MARGIN (20U)
+#endif /* PM_LATENCY_CALIBRATION_MARGIN */
+
+/*!
+ * @brief If set to 1, PM_EnterLowPowerUntil() enters low power until an absolute deadline given as a timestamp of the
+ * timer controller. The remaining time is computed again just before the low power timer is started.
+ */
+#ifndef FSL_PM_SUPPORT_DEADLINE
+#define FSL_PM_SUPPORT_DEADLINE (0)
+#endif /* FSL_PM_SUPPORT_DEADLINE */
+
+#if (FSL_PM_SUPPORT_DEADLINE && !FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
+#error FSL_PM_SUPPORT_DEADLINE requires FSL_PM_SUPPORT_LP_TIMER_CONTROLLER.
+#endif
+
+/*!
+ * @brief If set to 1, a time base registered with PM_RegisterTimeBase() gives the frequency of the low power timer.
+ * The durations given in timer ticks are converted once to microseconds, the unit of the exit latencies, and the
+ * policy works in microseconds. The low power timer is started with a duration converted back to ticks.
+ */
+#ifndef FSL_PM_SUPPORT_TIME_BASE
+#define FSL_PM_SUPPORT_TIME_BASE (0)
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+
+#if (FSL_PM_SUPPORT_TIME_BASE && !FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
+#error FSL_PM_SUPPORT_TIME_BASE requires FSL_PM_SUPPORT_LP_TIMER_CONTROLLER.
+#endif
+
+/*!
+ * @brief If set to 1, the power state is chosen among the states allowed by the constraints by a governor function
+ * registered with PM_RegisterGovernor(), instead of always taking the deepest one.
+ */
+#ifndef FSL_PM_SUPPORT_GOVERNOR
+#define FSL_PM_SUPPORT_GOVERNOR (0)
+#endif /* FSL_PM_SUPPORT_GOVERNOR */
+
+/*!
+ * @brief Number of consecutive residencies longer than the break-even time of the next deeper power state needed by
+ * PM_GovernorLadder() to promote to that state.
+ */
+#ifndef PM_GOVERNOR_LADDER_PROMOTE_COUNT
+#define PM_GOVERNOR_LADDER_PROMOTE_COUNT (3U)
+#endif /* PM_GOVERNOR_LADDER_PROMOTE_COUNT */
+
 /*!
  * @brief If defined FSL_PM_SUPPORT_ALWAYS_ON_SECTION and set the macro to 1, then some critical
  * data of the power manager will be placed into the RAM section that is always powered on.
@@ -31,6 +222,29 @@
 #define FSL_PM_SUPPORT_ALWAYS_ON_SECTION (0)
 #endif /* FSL_PM_SUPPORT_ALWAYS_ON_SECTION */
 
+/*!
+ * @brief Width in bits of the constraint reference counters, 8, 16 or 32. Each counter holds the number of
+ * outstanding set requests of a power mode constraint or of a resource constraint operate mode.
+ */
+#ifndef FSL_PM_CONSTRAINT_COUNTER_WIDTH
+#define FSL_PM_CONSTRAINT_COUNTER_WIDTH (8U)
+#endif /* FSL_PM_CONSTRAINT_COUNTER_WIDTH */
+
+/*!
+ * @brief If set to 1, constraints set with PM_SetOwnedConstraints() are recorded with their owner id so that the
+ * holders of a constraint can be queried with PM_GetConstraintOwners().
+ */
+#ifndef FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING
+#define FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING (0)
+#endif /* FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING */
+
+/*!
+ * @brief Number of (owner, constraint) records in the owner tracking table.
+ */
+#ifndef PM_CONSTRAINT_OWNER_TABLE_SIZE
+#define PM_CONSTRAINT_OWNER_TABLE_SIZE (16U)
+#endif /* PM_CONSTRAINT_OWNER_TABLE_SIZE */
+
 #ifndef PM_CONSTRAINT_COUNT
 #define PM_CONSTRAINT_COUNT (0U)
 #endif /* PM_CONSTRAINT_COUNT */
@@ -52,6 +266,9 @@
 #define PM_RESOURCE_PARTABLE_ON2 (2U)
 #define PM_RESOURCE_FULL_ON      (4U)
 
+/* Number of operate modes a resource constraint can request, one counter is kept for each of them. */
+#define PM_RESOURCE_OP_MODE_NUM (3U)
+
 #ifndef PM_ENCODE_RESC
 #define PM_ENCODE_RESC(opMode, rescShift) ((((uint32_t)(opMode)) << 8UL) | (rescShift))
 #endif /* PM_ENCODE_RESC */
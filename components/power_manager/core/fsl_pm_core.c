@@ -19,24 +19,104 @@
  * Error doesn't happen in test case.
  */
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+/* Power mode constraints share the constraint encoding of PM_ENCODE_RESC() with this flag set. */
+#define PM_MODE_CONSTRAINT_FLAG       (0x8000UL)
+#define PM_MODE_CONSTRAINT(mode)      (PM_MODE_CONSTRAINT_FLAG | (uint32_t)(mode))
+#define PM_CONSTRAINT_RESC_INDEX_MASK (PM_MODE_CONSTRAINT_FLAG | 0xFFUL)
+
+/* PM_RESOURCE_PARTABLE_ON1, PM_RESOURCE_PARTABLE_ON2 and PM_RESOURCE_FULL_ON map to counter 0, 1 and 2. */
+#define PM_RESC_OP_MODE_INDEX(opMode) ((uint32_t)(opMode) >> 1UL)
+
+/* Owner of the constraints set with PM_SetConstraints(), such constraints are not recorded. */
+#define PM_CONSTRAINT_NO_OWNER (0x100UL)
+
+#if (defined(FSL_PM_SUPPORT_RESOURCE_DEPENDENCY) && FSL_PM_SUPPORT_RESOURCE_DEPENDENCY)
+/* Actions of PM_UpdateResourceDependency(). */
+#define PM_DEPENDENCY_CHECK (0U)
+#define PM_DEPENDENCY_TAKE  (1U)
+#define PM_DEPENDENCY_DROP  (2U)
+#endif /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK)
+#define PM_NOTIFY_IS_FALLBACK(status) \
+    (((status) >= PM_NOTIFY_FALLBACK(0U)) && ((status) < PM_NOTIFY_FALLBACK(PM_LP_STATE_COUNT)))
+#define PM_NOTIFY_FALLBACK_STATE(status) ((uint8_t)((status)-PM_NOTIFY_FALLBACK(0U)))
+
+/* notifiedState of the notifiers skipped on entry. */
+#define PM_NOTIFY_NO_STATE (0xFFU)
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK */
+
 /*******************************************************************************
  * Variables
  ******************************************************************************/
 extern pm_device_option_t g_devicePMOption;
 AT_ALWAYS_ON_DATA(static pm_handle_t *s_pmHandle);
 
-static uint32_t s_defaultPMIrqMask = 0UL;
+#if (defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+/* Static tables bounds, defined by the linker script. */
+#if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
+extern pm_notify_element_t __pm_notify_group0_start__[];
+extern pm_notify_element_t __pm_notify_group0_end__[];
+extern pm_notify_element_t __pm_notify_group1_start__[];
+extern pm_notify_element_t __pm_notify_group1_end__[];
+extern pm_notify_element_t __pm_notify_group2_start__[];
+extern pm_notify_element_t __pm_notify_group2_end__[];
+
+static pm_notify_element_t *const s_notifyTableStart[3U] = {__pm_notify_group0_start__, __pm_notify_group1_start__,
+                                                            __pm_notify_group2_start__};
+static pm_notify_element_t *const s_notifyTableEnd[3U]   = {__pm_notify_group0_end__, __pm_notify_group1_end__,
+                                                          __pm_notify_group2_end__};
+
+/* The notifiers of the static table were prepared by a first PM_InitHandle(). */
+static bool s_staticNotifyTableReady = false;
+#endif /* FSL_PM_SUPPORT_NOTIFICATION */
+
+#if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
+extern pm_wakeup_source_t __pm_wakeup_source_table_start__[];
+extern pm_wakeup_source_t __pm_wakeup_source_table_end__[];
+#endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
 
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/
 
 #if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
-static status_t PM_notifyPowerStateEntry(uint8_t powerState);
-static status_t PM_notifyPowerStateExit(uint8_t powerState);
+static pm_notify_element_t *PM_GetFirstNotify(pm_handle_t *handle, uint8_t group);
+static pm_notify_element_t *PM_GetNextNotify(pm_notify_element_t *notifyElement, uint8_t group);
+static status_t PM_notifyPowerStateEntry(pm_handle_t *handle, uint8_t powerState);
+static status_t PM_notifyPowerStateExit(pm_handle_t *handle, uint8_t powerState);
+static status_t PM_callNotifyEntry(pm_handle_t *handle, pm_notify_element_t *notifyElement, uint8_t *powerState);
+static void PM_callNotifyExit(pm_notify_element_t *notifyElement, uint8_t powerState);
+#if (defined(FSL_PM_SUPPORT_DEFERRED_NOTIFY) && FSL_PM_SUPPORT_DEFERRED_NOTIFY)
+static pm_notify_element_t *PM_TakeDeferredNotify(pm_handle_t *handle);
+#endif /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
+#if (defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+static void PM_InitStaticNotifyTable(pm_handle_t *handle);
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
 #endif /* FSL_PM_SUPPORT_NOTIFICATION */
 
-static void PM_SetAllowedLowestPowerMode(void);
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK) || \
+    (defined(FSL_PM_SUPPORT_DEADLINE) && FSL_PM_SUPPORT_DEADLINE)
+static uint8_t PM_FindFallbackState(pm_handle_t *handle, uint8_t toleratedState, uint8_t powerState, uint64_t duration);
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK || FSL_PM_SUPPORT_DEADLINE */
+
+static void PM_SetAllowedLowestPowerMode(pm_handle_t *handle);
+static void PM_EnterPowerState(pm_handle_t *handle, uint8_t stateIndex);
+static void PM_SelectDeepestState(pm_handle_t *handle, uint64_t duration, pm_deepest_state_results_t *results);
+static status_t PM_SetConstraintList(pm_handle_t *handle,
+                                     uint32_t owner,
+                                     uint8_t powerModeConstraint,
+                                     int32_t rescNum,
+                                     va_list ap);
+static status_t PM_ReleaseConstraintList(pm_handle_t *handle,
+                                         uint32_t owner,
+                                         uint8_t powerModeConstraint,
+                                         int32_t rescNum,
+                                         va_list ap);
 
 /*******************************************************************************
  * Code
@@ -46,48 +126,271 @@ static void PM_SetAllowedLowestPowerMode(void);
  * Private Funtions
  ***************************************************************/
 #if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
-static status_t PM_notifyPowerStateEntry(uint8_t powerState)
+/* First notifier of a group, NULL if the group is empty. */
+static pm_notify_element_t *PM_GetFirstNotify(pm_handle_t *handle, uint8_t group)
+{
+#if (defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+    (void)handle;
+    return (s_notifyTableStart[group] != s_notifyTableEnd[group]) ? s_notifyTableStart[group] : NULL;
+#else
+    return (pm_notify_element_t *)(void *)(handle->notifyList[group].head);
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+}
+
+/* Notifier following notifyElement in its group, NULL at the end of the group. */
+static pm_notify_element_t *PM_GetNextNotify(pm_notify_element_t *notifyElement, uint8_t group)
+{
+#if (defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+    return (&notifyElement[1] != s_notifyTableEnd[group]) ? &notifyElement[1] : NULL;
+#else
+    (void)group;
+    return (pm_notify_element_t *)(void *)(notifyElement->link.next);
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+}
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+static void PM_UpdateNotifyTiming(pm_notify_timing_t *timing, uint32_t cycles)
+{
+    if ((timing->count == 0U) || (cycles < timing->minCycles))
+    {
+        timing->minCycles = cycles;
+    }
+
+    if (cycles > timing->maxCycles)
+    {
+        timing->maxCycles = cycles;
+    }
+
+    timing->totalCycles += cycles;
+    timing->count++;
+}
+
+/* Add or remove the exit latency budget of a notifier to the power states it is called for. */
+static void PM_UpdateNotifyLatencyBudget(pm_handle_t *handle, pm_notify_element_t *notifyElement, bool add)
+{
+    uint8_t stateIndex;
+    bool wakeupPath = true;
+
+#if (defined(FSL_PM_SUPPORT_DEFERRED_NOTIFY) && FSL_PM_SUPPORT_DEFERRED_NOTIFY)
+    /* A deferred exit callback is not on the wakeup path. */
+    wakeupPath = !notifyElement->deferExit;
+#endif /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
+
+    for (stateIndex = 0U; (stateIndex < PM_LP_STATE_COUNT) && wakeupPath; stateIndex++)
+    {
+#if (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+        if ((notifyElement->stateMask & PM_NOTIFY_STATE(stateIndex)) != 0UL)
+#endif /* FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+        {
+            if (add)
+            {
+                handle->notifyLatencyBudget[stateIndex] += notifyElement->exitLatencyBudget;
+            }
+            else
+            {
+                handle->notifyLatencyBudget[stateIndex] -= notifyElement->exitLatencyBudget;
+            }
+        }
+    }
+}
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+
+/*
+ * Call the entry callback of a notifier. When the notifier asks to fall back to a shallower state that the constraints
+ * allow, *powerState becomes that state and the notifier is called again with it if its state mask has it; otherwise
+ * its exit callback still gets the state it was called with. Return the status of the last callback, kStatus_Success
+ * once the fallback is taken.
+ */
+static status_t PM_callNotifyEntry(pm_handle_t *handle, pm_notify_element_t *notifyElement, uint8_t *powerState)
+{
+    status_t status;
+    bool retry;
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+    uint32_t startCycles;
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK)
+    uint8_t fallbackState;
+#else
+    (void)handle;
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK */
+
+    do
+    {
+        retry = false;
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+        startCycles = PM_GET_CYCLE_COUNT();
+        status      = notifyElement->notifyCallback(kPM_EventEnteringSleep, *powerState, notifyElement->data);
+        PM_UpdateNotifyTiming(&notifyElement->entryTiming, PM_GET_CYCLE_COUNT() - startCycles);
+#else
+        status = notifyElement->notifyCallback(kPM_EventEnteringSleep, *powerState, notifyElement->data);
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK)
+        notifyElement->notifiedState = *powerState;
+        if (PM_NOTIFY_IS_FALLBACK(status))
+        {
+            fallbackState = PM_FindFallbackState(handle, PM_NOTIFY_FALLBACK_STATE(status), *powerState, 0U);
+            if (fallbackState != 0xFFU)
+            {
+                *powerState         = fallbackState;
+                handle->targetState = fallbackState;
+                status              = kStatus_Success;
+#if (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+                retry = ((notifyElement->stateMask & PM_NOTIFY_STATE(fallbackState)) != 0UL);
+#else
+                retry = true;
+#endif /* FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+            }
+        }
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK */
+    } while (retry);
+
+    return status;
+}
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK) && \
+    (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+/*
+ * A notifier made the power manager fall back to *powerState. The notifiers called before it prepared for a deeper
+ * state, which covers the shallower one, but those skipped for the deeper state are called now if their state mask
+ * has the shallower one. The walk starts over each time one of them falls back further. lastElement is the notifier
+ * that fell back first, in group lastGroup, the walk stops before it.
+ */
+static status_t PM_notifyFallbackDelta(pm_handle_t *handle,
+                                       uint8_t lastGroup,
+                                       pm_notify_element_t *lastElement,
+                                       uint8_t *powerState)
+{
+    status_t status = kStatus_Success;
+    pm_notify_element_t *currElement;
+    uint8_t walkState;
+    uint8_t i;
+
+    do
+    {
+        walkState = *powerState;
+        for (i = (uint8_t)kPM_NotifyGroup0;
+             (i <= lastGroup) && (status == kStatus_Success) && (walkState == *powerState); i++)
+        {
+            currElement = PM_GetFirstNotify(handle, i);
+            while ((currElement != NULL) && (currElement != lastElement) && (status == kStatus_Success) &&
+                   (walkState == *powerState))
+            {
+                if ((currElement->notifiedState == PM_NOTIFY_NO_STATE) &&
+                    ((currElement->stateMask & PM_NOTIFY_STATE(*powerState)) != 0UL))
+                {
+                    status = PM_callNotifyEntry(handle, currElement, powerState);
+                }
+                currElement = PM_GetNextNotify(currElement, i);
+            }
+        }
+    } while ((status == kStatus_Success) && (walkState != *powerState));
+
+    return status;
+}
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK && FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+
+static status_t PM_notifyPowerStateEntry(pm_handle_t *handle, uint8_t powerState)
 {
     uint8_t i;
-    pm_notify_callback_func_t callback;
     pm_notify_element_t *currElement = NULL;
     status_t status                  = kStatus_PMSuccess;
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK) && \
+    (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+    uint8_t calledState;
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK && FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+
+#if (defined(FSL_PM_SUPPORT_DEFERRED_NOTIFY) && FSL_PM_SUPPORT_DEFERRED_NOTIFY)
+    /* The exit callbacks still pending must run before the next entry callbacks. */
+    for (currElement = PM_TakeDeferredNotify(handle); currElement != NULL; currElement = PM_TakeDeferredNotify(handle))
+    {
+        PM_callNotifyExit(currElement, handle->deferredNotifyState);
+    }
+#endif /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
 
     /* Execute from group0 to group2. */
     for (i = (uint8_t)kPM_NotifyGroup0; i <= (uint8_t)kPM_NotifyGroup2; i++)
     {
-        s_pmHandle->curNotifyGroup = (pm_notify_group_t)i;
-        if (LIST_GetSize((list_handle_t) & (s_pmHandle->notifyList[i])) != 0UL)
+        handle->curNotifyGroup = (pm_notify_group_t)i;
+        currElement            = PM_GetFirstNotify(handle, i);
+        if (currElement != NULL)
         {
-            currElement = (pm_notify_element_t *)(void *)(s_pmHandle->notifyList[i].head);
-
             do
             {
-                callback = currElement->notifyCallback;
-                status   = callback(kPM_EventEnteringSleep, powerState, currElement->data);
-                if (status != kStatus_Success)
+#if (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+                /* Skip the notifiers not interested in this power state. */
+                if ((currElement->stateMask & PM_NOTIFY_STATE(powerState)) != 0UL)
+#endif /* FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+                {
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK) && \
+    (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+                    calledState = powerState;
+                    status      = PM_callNotifyEntry(handle, currElement, &powerState);
+                    if ((status == kStatus_Success) && (powerState != calledState))
+                    {
+                        status = PM_notifyFallbackDelta(handle, i, currElement, &powerState);
+                    }
+#else
+                    status = PM_callNotifyEntry(handle, currElement, &powerState);
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK && FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+                    if (status != kStatus_Success)
+                    {
+                        handle->curNotifyElement = currElement;
+                        return kStatus_PMNotifyEventError;
+                    }
+                }
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK) && \
+    (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+                else
                 {
-                    s_pmHandle->curNotifyElement = currElement;
-                    return kStatus_PMNotifyEventError;
+                    currElement->notifiedState = PM_NOTIFY_NO_STATE;
                 }
-                currElement = (pm_notify_element_t *)(void *)currElement->link.next;
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK && FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+                currElement = PM_GetNextNotify(currElement, i);
             } while (currElement != NULL);
         }
     }
 
-    s_pmHandle->curNotifyGroup   = kPM_NotifyGroup2;
-    s_pmHandle->curNotifyElement = NULL;
+    handle->curNotifyGroup   = kPM_NotifyGroup2;
+    handle->curNotifyElement = NULL;
     return kStatus_PMSuccess;
 }
 
-static status_t PM_notifyPowerStateExit(uint8_t powerState)
+/* Call the exit callback of a notifier. */
+static void PM_callNotifyExit(pm_notify_element_t *notifyElement, uint8_t powerState)
+{
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+    uint32_t startCycles;
+    uint32_t cycles;
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK)
+    /* Deeper than powerState if a later notifier made the power manager fall back. */
+    powerState = notifyElement->notifiedState;
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK */
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+
+    startCycles = PM_GET_CYCLE_COUNT();
+    (void)(notifyElement->notifyCallback(kPM_EventExitingSleep, powerState, notifyElement->data));
+    cycles = PM_GET_CYCLE_COUNT() - startCycles;
+    PM_UpdateNotifyTiming(&notifyElement->exitTiming, cycles);
+    if (cycles > (notifyElement->exitLatencyBudget * PM_CYCLES_PER_US()))
+    {
+        notifyElement->budgetOverrunCount++;
+    }
+#else
+    (void)(notifyElement->notifyCallback(kPM_EventExitingSleep, powerState, notifyElement->data));
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+}
+
+static status_t PM_notifyPowerStateExit(pm_handle_t *handle, uint8_t powerState)
 {
     int8_t i;
     pm_notify_element_t *currElement = NULL;
 
-    if (s_pmHandle->curNotifyElement != NULL)
+    if (handle->curNotifyElement != NULL)
     {
-        i = (int8_t)(s_pmHandle->curNotifyGroup);
+        i = (int8_t)(handle->curNotifyGroup);
     }
     else
     {
@@ -95,863 +398,2960 @@ static status_t PM_notifyPowerStateExit(uint8_t powerState)
         i = (int8_t)kPM_NotifyGroup2;
     }
 
+#if (defined(FSL_PM_SUPPORT_DEFERRED_NOTIFY) && FSL_PM_SUPPORT_DEFERRED_NOTIFY)
+    handle->deferredNotifyState = powerState;
+#endif /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
+
     /* Execute from group2 to group0. */
     for (; i >= (int8_t)kPM_NotifyGroup0; i--)
     {
-        if (LIST_GetSize((list_handle_t) & (s_pmHandle->notifyList[i])) != 0UL)
+        currElement = PM_GetFirstNotify(handle, (uint8_t)i);
+        if (currElement != NULL)
         {
-            currElement = (pm_notify_element_t *)(void *)(s_pmHandle->notifyList[i].head);
-
             do
             {
-                (void)(currElement->notifyCallback(kPM_EventExitingSleep, powerState, currElement->data));
-                if (currElement == s_pmHandle->curNotifyElement)
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK) && \
+    (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+                /* Skip the notifiers that were not called on entry. */
+                if (currElement->notifiedState != PM_NOTIFY_NO_STATE)
+#elif (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+                /* Skip the notifiers not interested in this power state. */
+                if ((currElement->stateMask & PM_NOTIFY_STATE(powerState)) != 0UL)
+#endif /* FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+                {
+#if (defined(FSL_PM_SUPPORT_DEFERRED_NOTIFY) && FSL_PM_SUPPORT_DEFERRED_NOTIFY)
+                    if (currElement->deferExit)
+                    {
+                        /* Leave the wakeup path, the callback is run by PM_RunDeferredNotify(). */
+                        currElement->exitPending = true;
+                        handle->deferredNotifyCount++;
+                    }
+                    else
+#endif /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
+                    {
+                        PM_callNotifyExit(currElement, powerState);
+                    }
+                }
+                if (currElement == handle->curNotifyElement)
                 {
                     break;
                 }
-                currElement = (pm_notify_element_t *)(void *)(currElement->link.next);
+                currElement = PM_GetNextNotify(currElement, (uint8_t)i);
             } while (currElement != NULL);
         }
     }
 
     return kStatus_PMSuccess;
 }
+
+#if (defined(FSL_PM_SUPPORT_DEFERRED_NOTIFY) && FSL_PM_SUPPORT_DEFERRED_NOTIFY)
+/* Take the first notifier, in the exit order, whose exit callback is pending. Its pending flag is cleared so that
+ * the callback runs only once. */
+static pm_notify_element_t *PM_TakeDeferredNotify(pm_handle_t *handle)
+{
+    int8_t i;
+    pm_notify_element_t *currElement = NULL;
+
+    for (i = (int8_t)kPM_NotifyGroup2; (i >= (int8_t)kPM_NotifyGroup0) && (handle->deferredNotifyCount != 0U);
+         i--)
+    {
+        currElement = PM_GetFirstNotify(handle, (uint8_t)i);
+        while ((currElement != NULL) && (!currElement->exitPending))
+        {
+            currElement = PM_GetNextNotify(currElement, (uint8_t)i);
+        }
+
+        if (currElement != NULL)
+        {
+            currElement->exitPending = false;
+            handle->deferredNotifyCount--;
+            break;
+        }
+    }
+
+    return currElement;
+}
+#endif /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
+
+#if (defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+/*
+ * Prepare the notifiers of the static table as PM_RegisterNotify() does for the registered ones. The table is shared
+ * by all the handles: its notifiers are only prepared when the first handle is initialized, and each handle adds
+ * their latency budgets to its own.
+ */
+static void PM_InitStaticNotifyTable(pm_handle_t *handle)
+{
+    uint8_t i;
+    pm_notify_element_t *currElement;
+
+    for (i = (uint8_t)kPM_NotifyGroup0; i <= (uint8_t)kPM_NotifyGroup2; i++)
+    {
+        for (currElement = PM_GetFirstNotify(handle, i); currElement != NULL;
+             currElement = PM_GetNextNotify(currElement, i))
+        {
+#if (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+            if ((!s_staticNotifyTableReady) && (currElement->stateMask == 0UL))
+            {
+                currElement->stateMask = PM_NOTIFY_ALL_STATES;
+            }
+#endif /* FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+            PM_UpdateNotifyLatencyBudget(handle, currElement, true);
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+        }
+    }
+
+    s_staticNotifyTableReady = true;
+}
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
 #endif /* FSL_PM_SUPPORT_NOTIFICATION */
 
-static void PM_SetAllowedLowestPowerMode(void)
+static void PM_SetAllowedLowestPowerMode(pm_handle_t *handle)
 {
     uint8_t lowestPowerMode = PM_LP_STATE_COUNT - 1U;
     uint8_t index;
 
     for (index = 0U; index < PM_LP_STATE_COUNT; index++)
     {
-        if (s_pmHandle->powerModeConstraintCount[index] > 0U)
+        if (handle->powerModeConstraintCount[index] > 0U)
         {
             lowestPowerMode = index;
             break;
         }
     }
 
-    s_pmHandle->powerModeConstraint = lowestPowerMode;
+    handle->powerModeConstraint = lowestPowerMode;
 }
 
-static void PM_EnterCriticalDefault(void)
+static status_t PM_SetPowerModeConstraint(pm_handle_t *handle, uint8_t powerModeConstraint)
+{
+    status_t ret = kStatus_Success;
+
+    if (powerModeConstraint >= PM_LP_STATE_COUNT)
+    {
+        /* wrong power mode index passed in parameter */
+        ret = kStatus_Fail;
+    }
+    else if (handle->powerModeConstraintCount[powerModeConstraint] == PM_CONSTRAINT_COUNT_MAX)
+    {
+        ret = kStatus_PMConstraintCountOverflow;
+    }
+    else
+    {
+        handle->powerModeConstraintCount[powerModeConstraint]++;
+        PM_SetAllowedLowestPowerMode(handle);
+    }
+
+    return ret;
+}
+
+static status_t PM_ReleasePowerModeConstraint(pm_handle_t *handle, uint8_t powerModeConstraint)
 {
-    s_defaultPMIrqMask = DisableGlobalIRQ();
+    status_t ret = kStatus_Success;
+
+    if (powerModeConstraint >= PM_LP_STATE_COUNT)
+    {
+        /* wrong power mode index passed in parameter */
+        ret = kStatus_Fail;
+    }
+    else
+    {
+        if (handle->powerModeConstraintCount[powerModeConstraint] > 0U)
+        {
+            handle->powerModeConstraintCount[powerModeConstraint]--;
+        }
+        PM_SetAllowedLowestPowerMode(handle);
+    }
+
+    return ret;
 }
 
-static void PM_ExitCriticalDefault(void)
+static bool PM_IsResourceCountFull(pm_handle_t *handle, uint32_t opModeIndex, uint32_t rescShift)
 {
-    EnableGlobalIRQ(s_defaultPMIrqMask);
+    return (handle->rescOpModeCount[rescShift][opModeIndex] == PM_CONSTRAINT_COUNT_MAX) ||
+           (handle->resConstraintCount[rescShift] == PM_CONSTRAINT_COUNT_MAX);
 }
 
-/***************************************************************
- * Public Funtions
- ***************************************************************/
-/*!
- * Finds the Deepest power state allowed by the current constraints.
- * Returns a structure that application can use to determine why this
- * is deepest state allowed.
- */
-//ToDo need to submit PR for updated PM_findDeepestState()
-void PM_findDeepestState(uint64_t duration, pm_deepest_state_results_t *results)
+static void PM_TakeResource(pm_handle_t *handle, uint32_t opMode, uint32_t rescShift)
 {
-    uint8_t i              = 0U;
-    uint8_t ret            = 0xFFU;
-    uint8_t j              = 0U;
-    uint8_t mask_bit_pos   = 0U;
-    uint32_t mask_compare  = 0U;
-    pm_state_t *state      = NULL;
-    bool stateSatisfy      = false;
-    pm_state_t *stateArray = s_pmHandle->deviceOption->states;
-    uint8_t stateCount     = (s_pmHandle->deviceOption->stateCount);
-    pm_resc_mask_t tmpSoftRescMask;
-    pm_deepest_state_reasons_t prev_mode_reason = 0xFF; /* no previous mode yet */
-    pm_deepest_state_reasons_t curr_mode_reason = kPM_reason_deepest;
+    handle->rescOpModeCount[rescShift][PM_RESC_OP_MODE_INDEX(opMode)]++;
+    handle->resConstraintCount[rescShift]++;
+    handle->sysRescGroup.groupSlice[rescShift / 8UL] |= (opMode << (4UL * (rescShift % 8UL)));
+    handle->resConstraintMask.rescMask[rescShift / 32UL] |= (1UL << (rescShift % 32UL));
+}
 
-    for (i = stateCount; i >= 1U; i--)
+/* Return false if the operate mode of the resource was not requested. */
+static bool PM_DropResource(pm_handle_t *handle, uint32_t opMode, uint32_t rescShift)
+{
+    uint32_t opModeIndex = PM_RESC_OP_MODE_INDEX(opMode);
+    bool dropped         = false;
+
+    if (handle->rescOpModeCount[rescShift][opModeIndex] > 0U)
     {
-        state = &stateArray[(i - 1U)];
+        handle->rescOpModeCount[rescShift][opModeIndex]--;
+        handle->resConstraintCount[rescShift]--;
 
-        stateSatisfy = false;
-        /*
-         * The next power state's exit latency should be smaller than low power duration.
-         * And the next power state should satisfy the whole system's constraints.
-         */
-        if (duration == 0U)
+        /* The operate mode is kept as long as one holder requests it */
+        if (handle->rescOpModeCount[rescShift][opModeIndex] == 0U)
         {
-            stateSatisfy = true;
+            handle->sysRescGroup.groupSlice[rescShift / 8UL] &= ~(opMode << (4UL * (rescShift % 8UL)));
         }
-        else
+
+        if (handle->resConstraintCount[rescShift] == 0U)
         {
-            if (state->exitLatency < duration)
-            {
-                /* If the total latency is less than the duration, then this state
-                 * satisfies the duration constraints */
-                stateSatisfy = true;
-            }
+            handle->resConstraintMask.rescMask[rescShift / 32UL] &= ~(1UL << (rescShift % 32UL));
         }
 
-        /* If the state satisfies the duration constraints, check the other system
-         * constraints */
-        if (stateSatisfy == true)
+        dropped = true;
+    }
+
+    return dropped;
+}
+
+#if (defined(FSL_PM_SUPPORT_RESOURCE_DEPENDENCY) && FSL_PM_SUPPORT_RESOURCE_DEPENDENCY)
+/*
+ * Check, take or drop the prerequisites of a resource. The board table already holds the transitive closure, so each
+ * prerequisite is visited once without recursion. For PM_DEPENDENCY_CHECK, false is returned if the counter of one
+ * prerequisite is full.
+ */
+static bool PM_UpdateResourceDependency(pm_handle_t *handle, uint32_t rescShift, uint8_t action)
+{
+    const pm_resc_mask_t *dependency;
+    uint32_t mask;
+    uint32_t i;
+    uint32_t j;
+    bool ret = true;
+
+    if (handle->deviceOption->rescDependency != NULL)
+    {
+        dependency = &(handle->deviceOption->rescDependency[rescShift]);
+        for (i = 0U; i < (uint32_t)PM_RESC_MASK_ARRAY_SIZE; i++)
         {
-            for (j = 0U; j < PM_RESC_MASK_ARRAY_SIZE; j++)
+            mask = dependency->rescMask[i];
+            for (j = 0U; mask != 0UL; j++, mask >>= 1UL)
             {
-                mask_compare = s_pmHandle->resConstraintMask.rescMask[j] & state->fixConstraintsMask.rescMask[j];
-                if (mask_compare == 0UL)
+                if ((mask & 1UL) == 0UL)
                 {
-                    tmpSoftRescMask.rescMask[j] =
-                        state->varConstraintsMask.rescMask[j] & (s_pmHandle->resConstraintMask.rescMask[j]);
+                    continue;
                 }
-                else
-                {
-                    stateSatisfy = false;
-                    curr_mode_reason = kPM_reason_resc;
-                    results->resc_num = 0xFFU;
 
-                    /* Get first bit set in the mask_compare to report back the resc number */
-                    for(mask_bit_pos = 0; mask_bit_pos < 32; mask_bit_pos++)
+                if (action == PM_DEPENDENCY_CHECK)
+                {
+                    if (PM_IsResourceCountFull(handle, PM_RESC_OP_MODE_INDEX(PM_RESOURCE_FULL_ON), (i * 32UL) + j))
                     {
-                        if(mask_compare & 0x1)
-                        {
-                            /* found the resc bit position */
-                            results->resc_num = j * 32U + mask_bit_pos;
-                            break;
-                        }
-                        mask_compare = mask_compare >> 1;
+                        ret = false;
                     }
-                    assert(results->resc_num != 0xFFU);
-                    break;
+                }
+                else if (action == PM_DEPENDENCY_TAKE)
+                {
+                    PM_TakeResource(handle, PM_RESOURCE_FULL_ON, (i * 32UL) + j);
+                }
+                else
+                {
+                    (void)PM_DropResource(handle, PM_RESOURCE_FULL_ON, (i * 32UL) + j);
                 }
             }
-        } else
-        {
-            curr_mode_reason = kPM_reason_latency;
         }
+    }
+
+    return ret;
+}
+#endif /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
+
+static status_t PM_SetResourceConstraint(pm_handle_t *handle, uint32_t opMode, uint32_t rescShift)
+{
+    status_t ret = kStatus_Success;
+
+    assert(rescShift < (uint32_t)PM_CONSTRAINT_COUNT);
+
+    if (opMode != PM_RESOURCE_OFF)
+    {
+        assert(PM_RESC_OP_MODE_INDEX(opMode) < PM_RESOURCE_OP_MODE_NUM);
 
-        if (stateSatisfy)
+        if (PM_IsResourceCountFull(handle, PM_RESC_OP_MODE_INDEX(opMode), rescShift))
         {
-            if((i - 1U) <= s_pmHandle->powerModeConstraint)
-            {
-                (void)memcpy(&s_pmHandle->softConstraints, &tmpSoftRescMask, sizeof(pm_resc_mask_t));
-                ret = (i - 1U);
-                break;
-            }
-            else 
+            ret = kStatus_PMConstraintCountOverflow;
+        }
+#if (defined(FSL_PM_SUPPORT_RESOURCE_DEPENDENCY) && FSL_PM_SUPPORT_RESOURCE_DEPENDENCY)
+        /* Check the prerequisites first, so that a failure leaves every counter untouched */
+        else if ((opMode == PM_RESOURCE_FULL_ON) &&
+                 !PM_UpdateResourceDependency(handle, rescShift, PM_DEPENDENCY_CHECK))
+        {
+            ret = kStatus_PMConstraintCountOverflow;
+        }
+#endif /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
+        else
+        {
+            PM_TakeResource(handle, opMode, rescShift);
+#if (defined(FSL_PM_SUPPORT_RESOURCE_DEPENDENCY) && FSL_PM_SUPPORT_RESOURCE_DEPENDENCY)
+            if (opMode == PM_RESOURCE_FULL_ON)
             {
-                curr_mode_reason = kPM_reason_mode_constraint;
+                (void)PM_UpdateResourceDependency(handle, rescShift, PM_DEPENDENCY_TAKE);
             }
+#endif /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
         }
-
-        prev_mode_reason = curr_mode_reason;
     }
 
-    if(ret == (stateCount - 1))
-    {
-        results->reason = kPM_reason_deepest;
-    } else
-    {
-        results->reason = prev_mode_reason;
-    }
-    results->deepestState = ret;
+    return ret;
 }
 
-/*!
- * brief Initialize the power manager handle, this function should be invoked before using other power manager
- * APIs.
- *
- * note In default, the power manager is disabled.
- *
- * param handle Pointer to the pm_handle_t structure, upper layer software should pre-allocate the handle global
- * variable.
- */
-void PM_CreateHandle(pm_handle_t *handle)
+static void PM_ReleaseResourceConstraint(pm_handle_t *handle, uint32_t opMode, uint32_t rescShift)
 {
-    assert(handle != NULL);
+    assert(rescShift < (uint32_t)PM_CONSTRAINT_COUNT);
 
-    /* Clear handle. */
-    (void)memset(handle, 0, sizeof(*handle));
+    if (opMode != PM_RESOURCE_OFF)
+    {
+        assert(PM_RESC_OP_MODE_INDEX(opMode) < PM_RESOURCE_OP_MODE_NUM);
 
-    handle->enable = false;
-    /* Initial value is set to 1 as Power Manager is disabled by default */
-    handle->disableCount = 1;
-    handle->deviceOption = &g_devicePMOption;
-#if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
-    handle->timerStart       = NULL;
-    handle->timerStop        = NULL;
-    handle->getTimerDuration = NULL;
-    handle->getTimestamp     = NULL;
-#endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
+#if (defined(FSL_PM_SUPPORT_RESOURCE_DEPENDENCY) && FSL_PM_SUPPORT_RESOURCE_DEPENDENCY)
+        /* The prerequisites are only dropped if the resource was actually requested */
+        if (PM_DropResource(handle, opMode, rescShift) && (opMode == PM_RESOURCE_FULL_ON))
+        {
+            (void)PM_UpdateResourceDependency(handle, rescShift, PM_DEPENDENCY_DROP);
+        }
+#else
+        (void)PM_DropResource(handle, opMode, rescShift);
+#endif /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
+    }
+}
 
-    handle->enterCritical = PM_EnterCriticalDefault;
-    handle->exitCritical  = PM_ExitCriticalDefault;
+#if (defined(FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING) && FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING)
+/* Find the record of owner for constraint, or a free record if allocate is true. */
+static pm_constraint_owner_record_t *PM_GetOwnerRecord(pm_handle_t *handle,
+                                                       uint32_t owner,
+                                                       uint32_t constraint,
+                                                       bool allocate)
+{
+    uint8_t i;
+    pm_constraint_owner_record_t *record     = NULL;
+    pm_constraint_owner_record_t *freeRecord = NULL;
 
-#if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
-    /* Create notify lists. */
+    for (i = 0U; i < PM_CONSTRAINT_OWNER_TABLE_SIZE; i++)
+    {
+        if (handle->ownerTable[i].count == 0U)
+        {
+            if (freeRecord == NULL)
+            {
+                freeRecord = &handle->ownerTable[i];
+            }
+        }
+        else if ((handle->ownerTable[i].owner == owner) && (handle->ownerTable[i].constraint == constraint))
+        {
+            record = &handle->ownerTable[i];
+            break;
+        }
+        else
+        {
+            /* Record used by another owner or constraint */
+        }
+    }
+
+    if ((record == NULL) && allocate)
+    {
+        record = freeRecord;
+    }
+
+    return record;
+}
+
+static uint8_t PM_CollectConstraintOwners(pm_handle_t *handle,
+                                          uint32_t constraint,
+                                          uint32_t matchMask,
+                                          pm_constraint_owner_t *owners,
+                                          uint8_t maxOwners)
+{
+    uint8_t i;
+    uint8_t j;
+    uint8_t ownerCount = 0U;
+    bool duplicated;
+    pm_constraint_owner_record_t *record;
+
+    assert((owners != NULL) || (maxOwners == 0U));
+
+    PM_EnterCriticalRegion(handle);
+
+    for (i = 0U; i < PM_CONSTRAINT_OWNER_TABLE_SIZE; i++)
+    {
+        record = &handle->ownerTable[i];
+        if ((record->count != 0U) && ((record->constraint & matchMask) == constraint))
+        {
+            /* The same owner may hold several operate modes of the resource */
+            duplicated = false;
+            for (j = 0U; j < i; j++)
+            {
+                if ((handle->ownerTable[j].count != 0U) && (handle->ownerTable[j].owner == record->owner) &&
+                    ((handle->ownerTable[j].constraint & matchMask) == constraint))
+                {
+                    duplicated = true;
+                    break;
+                }
+            }
+
+            if (!duplicated)
+            {
+                if (ownerCount < maxOwners)
+                {
+                    owners[ownerCount] = record->owner;
+                }
+                ownerCount++;
+            }
+        }
+    }
+
+    PM_ExitCriticalRegion(handle);
+
+    return ownerCount;
+}
+#endif /* FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING */
+
+/* Set one power mode constraint (PM_MODE_CONSTRAINT) or one resource constraint (PM_ENCODE_RESC). */
+static status_t PM_SetOneConstraint(pm_handle_t *handle, uint32_t owner, uint32_t constraint)
+{
+    status_t ret = kStatus_Success;
+    uint32_t opMode;
+    uint32_t rescShift;
+#if (defined(FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING) && FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING)
+    pm_constraint_owner_record_t *record = NULL;
+
+    if (owner != PM_CONSTRAINT_NO_OWNER)
+    {
+        record = PM_GetOwnerRecord(handle, owner, constraint, true);
+        if (record == NULL)
+        {
+            ret = kStatus_PMConstraintOwnerTableFull;
+        }
+    }
+
+    if (ret == kStatus_Success)
+#else
+    (void)owner;
+#endif /* FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING */
+    {
+        if ((constraint & PM_MODE_CONSTRAINT_FLAG) != 0UL)
+        {
+            ret = PM_SetPowerModeConstraint(handle, (uint8_t)(constraint & 0xFFUL));
+        }
+        else
+        {
+            PM_DECODE_RESC(constraint);
+            ret = PM_SetResourceConstraint(handle, opMode, rescShift);
+        }
+    }
+
+#if (defined(FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING) && FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING)
+    if ((ret == kStatus_Success) && (record != NULL))
+    {
+        record->owner      = (pm_constraint_owner_t)owner;
+        record->constraint = (uint16_t)constraint;
+        record->count++;
+    }
+#endif /* FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING */
+
+    return ret;
+}
+
+static status_t PM_ReleaseOneConstraint(pm_handle_t *handle, uint32_t owner, uint32_t constraint)
+{
+    status_t ret = kStatus_Success;
+    uint32_t opMode;
+    uint32_t rescShift;
+#if (defined(FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING) && FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING)
+    pm_constraint_owner_record_t *record;
+
+    if (owner != PM_CONSTRAINT_NO_OWNER)
+    {
+        record = PM_GetOwnerRecord(handle, owner, constraint, false);
+        if (record == NULL)
+        {
+            ret = kStatus_PMConstraintNotOwned;
+        }
+        else
+        {
+            record->count--;
+        }
+    }
+
+    if (ret == kStatus_Success)
+#else
+    (void)owner;
+#endif /* FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING */
+    {
+        if ((constraint & PM_MODE_CONSTRAINT_FLAG) != 0UL)
+        {
+            ret = PM_ReleasePowerModeConstraint(handle, (uint8_t)(constraint & 0xFFUL));
+        }
+        else
+        {
+            PM_DECODE_RESC(constraint);
+            PM_ReleaseResourceConstraint(handle, opMode, rescShift);
+        }
+    }
+
+    return ret;
+}
+
+#if (defined(FSL_PM_SUPPORT_TIMED_CONSTRAINTS) && FSL_PM_SUPPORT_TIMED_CONSTRAINTS)
+static void PM_ReleaseTimedConstraintNow(pm_handle_t *handle, pm_timed_constraint_t *timedConstraint)
+{
+    (void)PM_ReleaseOneConstraint(handle, PM_CONSTRAINT_NO_OWNER, (uint32_t)timedConstraint->rescConstraint);
+    timedConstraint->held = false;
+}
+
+/* Release the timed constraints whose delay elapsed, and shorten duration to wake up when the next one expires. */
+static uint64_t PM_UpdateTimedConstraints(pm_handle_t *handle, uint64_t duration)
+{
+    uint64_t now;
+    uint64_t elapsed;
+    pm_timed_constraint_t *currElement;
+    pm_timed_constraint_t *nextElement;
+    bool timerAvailable = (handle->getTimestamp != NULL) && (handle->getTimerDuration != NULL);
+
+    PM_EnterCriticalRegion(handle);
+
+    if (LIST_GetSize((list_handle_t) & (handle->timedConstraintList)) != 0UL)
+    {
+        now         = (timerAvailable == true) ? handle->getTimestamp() : 0U;
+        currElement = (pm_timed_constraint_t *)(void *)(handle->timedConstraintList.head);
+
+        do
+        {
+            nextElement = (pm_timed_constraint_t *)(void *)(currElement->link.next);
+            elapsed     = (timerAvailable == true) ?
+                              handle->getTimerDuration(currElement->releaseTimestamp, now) :
+                              currElement->delay;
+
+            if (elapsed >= currElement->delay)
+            {
+                (void)LIST_RemoveElement((list_element_handle_t) & (currElement->link));
+                currElement->pending = false;
+                PM_ReleaseTimedConstraintNow(handle, currElement);
+            }
+            else if ((duration == 0U) || ((currElement->delay - elapsed) < duration))
+            {
+                duration = currElement->delay - elapsed;
+            }
+            else
+            {
+                /* This constraint expires after the low power period */
+            }
+
+            currElement = nextElement;
+        } while (currElement != NULL);
+    }
+
+    PM_ExitCriticalRegion(handle);
+
+    return duration;
+}
+#endif /* FSL_PM_SUPPORT_TIMED_CONSTRAINTS */
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_QOS) && FSL_PM_SUPPORT_LATENCY_QOS)
+/* Insert the request so that the list stays sorted by increasing maxLatency. */
+static status_t PM_InsertLatencyRequest(pm_handle_t *handle, pm_latency_request_t *request)
+{
+    status_t status                  = kStatus_PMSuccess;
+    list_status_t listStatus;
+    pm_latency_request_t *currRequest = (pm_latency_request_t *)(void *)(handle->latencyRequestList.head);
+
+    while ((currRequest != NULL) && (currRequest->maxLatency <= request->maxLatency))
+    {
+        currRequest = (pm_latency_request_t *)(void *)(currRequest->link.next);
+    }
+
+    if (currRequest == NULL)
+    {
+        listStatus =
+            LIST_AddTail((list_handle_t) & (handle->latencyRequestList), (list_element_handle_t) & (request->link));
+    }
+    else
+    {
+        listStatus =
+            LIST_AddPrevElement((list_element_handle_t) & (currRequest->link), (list_element_handle_t) & (request->link));
+    }
+
+    if (listStatus != kLIST_Ok)
+    {
+        status = kStatus_PMFail;
+    }
+
+    return status;
+}
+#endif /* FSL_PM_SUPPORT_LATENCY_QOS */
+
+/*
+ * Process the arguments of PM_SetConstraints() in a critical section of the handle, a failing constraint does not
+ * stop the following ones.
+ */
+static status_t PM_SetConstraintList(pm_handle_t *handle,
+                                     uint32_t owner,
+                                     uint8_t powerModeConstraint,
+                                     int32_t rescNum,
+                                     va_list ap)
+{
+    status_t ret  = kStatus_Success;
+    bool modeSet  = false;
+    int32_t count = 0;
+    int32_t i;
+    va_list applied;
+
+    /* The constraints are set all or none: on a failure, the ones already set are released. */
+    va_copy(applied, ap);
+    PM_EnterCriticalRegion(handle);
+
+    if (powerModeConstraint != PM_LP_STATE_NO_CONSTRAINT)
+    {
+        ret     = PM_SetOneConstraint(handle, owner, PM_MODE_CONSTRAINT(powerModeConstraint));
+        modeSet = (ret == kStatus_Success);
+    }
+
+    while ((ret == kStatus_Success) && (count < rescNum))
+    {
+        ret = PM_SetOneConstraint(handle, owner, (uint32_t)va_arg(ap, int32_t));
+        if (ret == kStatus_Success)
+        {
+            count++;
+        }
+    }
+
+    if (ret != kStatus_Success)
+    {
+        for (i = 0; i < count; i++)
+        {
+            (void)PM_ReleaseOneConstraint(handle, owner, (uint32_t)va_arg(applied, int32_t));
+        }
+
+        if (modeSet)
+        {
+            (void)PM_ReleaseOneConstraint(handle, owner, PM_MODE_CONSTRAINT(powerModeConstraint));
+        }
+    }
+
+    PM_ExitCriticalRegion(handle);
+    va_end(applied);
+
+    return ret;
+}
+
+static status_t PM_ReleaseConstraintList(pm_handle_t *handle,
+                                         uint32_t owner,
+                                         uint8_t powerModeConstraint,
+                                         int32_t rescNum,
+                                         va_list ap)
+{
+    status_t ret = kStatus_Success;
+    status_t status;
+    int32_t i;
+
+    PM_EnterCriticalRegion(handle);
+
+    if (powerModeConstraint != PM_LP_STATE_NO_CONSTRAINT)
+    {
+        ret = PM_ReleaseOneConstraint(handle, owner, PM_MODE_CONSTRAINT(powerModeConstraint));
+    }
+
+    for (i = 0; i < rescNum; i++)
+    {
+        status = PM_ReleaseOneConstraint(handle, owner, (uint32_t)va_arg(ap, int32_t));
+        if (ret == kStatus_Success)
+        {
+            ret = status;
+        }
+    }
+
+    PM_ExitCriticalRegion(handle);
+
+    return ret;
+}
+
+/*
+ * Exit latency used by the policy, the measured or software value plus margin if any, the board value otherwise,
+ * plus the budget of the exit notifiers.
+ */
+static uint32_t PM_GetExitLatency(pm_handle_t *handle, uint8_t stateIndex)
+{
+    uint32_t exitLatency = handle->deviceOption->states[stateIndex].exitLatency;
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_CALIBRATION) && FSL_PM_SUPPORT_LATENCY_CALIBRATION)
+    if ((handle->calibratedStates & (1UL << stateIndex)) != 0UL)
+    {
+        exitLatency = handle->exitLatency[stateIndex] + PM_LATENCY_CALIBRATION_MARGIN;
+    }
+#endif /* FSL_PM_SUPPORT_LATENCY_CALIBRATION */
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+    /* The exit notifiers run before the application gets the CPU back */
+    exitLatency += handle->notifyLatencyBudget[stateIndex];
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+
+    return exitLatency;
+}
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_CALIBRATION) && FSL_PM_SUPPORT_LATENCY_CALIBRATION)
+/*
+ * Return true if the coming low power period is used to calibrate the exit latency, with the calibration period
+ * stored into calibrationPeriod. The period and the current exit latency must fit in duration, 0 if unknown.
+ */
+static bool PM_StartLatencyCalibration(pm_handle_t *handle, uint8_t stateIndex, uint64_t duration)
+{
+    bool calibrate = (handle->calibrationRequested) && (handle->timerStart != NULL) &&
+                     (handle->latencyGetTimestamp != NULL) && (handle->latencyGetDuration != NULL);
+    uint32_t exitLatency;
+
+    if (calibrate)
+    {
+        handle->calibrationPeriod = PM_LATENCY_CALIBRATION_DURATION;
+        if (duration != 0U)
+        {
+            exitLatency = PM_GetExitLatency(handle, stateIndex);
+            if (duration <= (uint64_t)exitLatency)
+            {
+                calibrate = false;
+            }
+            else if ((duration - (uint64_t)exitLatency) < (uint64_t)handle->calibrationPeriod)
+            {
+                handle->calibrationPeriod = (uint32_t)(duration - (uint64_t)exitLatency);
+            }
+            else
+            {
+                /* The whole calibration period fits in the duration */
+            }
+        }
+    }
+
+    return calibrate;
+}
+
+/* Store the exit latency measured since calibrationTimestamp. */
+static void PM_EndLatencyCalibration(pm_handle_t *handle, uint8_t stateIndex)
+{
+    uint32_t elapsed = handle->latencyGetDuration(handle->calibrationTimestamp, handle->latencyGetTimestamp());
+
+    if (elapsed >= handle->calibrationPeriod)
+    {
+        handle->exitLatency[stateIndex] = elapsed - handle->calibrationPeriod;
+        handle->calibratedStates |= (1UL << stateIndex);
+        handle->calibrationRequested = false;
+    }
+    else
+    {
+        /*
+         * A shorter period means another wakeup source ended it, keep the request for the next entries. Each attempt
+         * shortens a low power entry, give up after PM_LATENCY_CALIBRATION_MAX_ATTEMPTS.
+         */
+        handle->calibrationAttempts++;
+        if (handle->calibrationAttempts >= PM_LATENCY_CALIBRATION_MAX_ATTEMPTS)
+        {
+            handle->calibrationRequested = false;
+        }
+    }
+}
+#endif /* FSL_PM_SUPPORT_LATENCY_CALIBRATION */
+
+/*
+ * Check the resource, latency QoS and power mode constraints of a power state, the duration is not checked.
+ * Return kPM_reason_deepest if the state is allowed, otherwise the reason that rules it out, with the blocking
+ * resource stored into rescNum for kPM_reason_resc. If the state is allowed, its optional resources are stored into
+ * softRescMask. rescNum and softRescMask can be NULL.
+ */
+static pm_deepest_state_reasons_t PM_CheckStateConstraints(pm_handle_t *handle,
+                                                           uint8_t stateIndex,
+                                                           uint32_t maxLatency,
+                                                           pm_resc_mask_t *softRescMask,
+                                                           uint8_t *rescNum)
+{
+    uint8_t j                         = 0U;
+    uint8_t mask_bit_pos              = 0U;
+    uint32_t mask_compare             = 0U;
+    pm_state_t *state                 = &(handle->deviceOption->states[stateIndex]);
+    pm_deepest_state_reasons_t reason = kPM_reason_deepest;
+    pm_resc_mask_t tmpSoftRescMask;
+
+    for (j = 0U; j < PM_RESC_MASK_ARRAY_SIZE; j++)
+    {
+        mask_compare = handle->resConstraintMask.rescMask[j] & state->fixConstraintsMask.rescMask[j];
+        if (mask_compare == 0UL)
+        {
+            tmpSoftRescMask.rescMask[j] =
+                state->varConstraintsMask.rescMask[j] & (handle->resConstraintMask.rescMask[j]);
+        }
+        else
+        {
+            reason = kPM_reason_resc;
+
+            if (rescNum != NULL)
+            {
+                *rescNum = 0xFFU;
+
+                /* Get first bit set in the mask_compare to report back the resc number */
+                for(mask_bit_pos = 0; mask_bit_pos < 32; mask_bit_pos++)
+                {
+                    if(mask_compare & 0x1)
+                    {
+                        /* found the resc bit position */
+                        *rescNum = j * 32U + mask_bit_pos;
+                        break;
+                    }
+                    mask_compare = mask_compare >> 1;
+                }
+                assert(*rescNum != 0xFFU);
+            }
+            break;
+        }
+    }
+
+    /* A state that wakes up slower than the most demanding latency request is not allowed */
+    if ((reason == kPM_reason_deepest) && (PM_GetExitLatency(handle, stateIndex) > maxLatency))
+    {
+        reason = kPM_reason_latency_qos;
+    }
+
+    if ((reason == kPM_reason_deepest) && (stateIndex > handle->powerModeConstraint))
+    {
+        reason = kPM_reason_mode_constraint;
+    }
+
+    if ((reason == kPM_reason_deepest) && (softRescMask != NULL))
+    {
+        (void)memcpy(softRescMask, &tmpSoftRescMask, sizeof(pm_resc_mask_t));
+    }
+
+    return reason;
+}
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK) || \
+    (defined(FSL_PM_SUPPORT_DEADLINE) && FSL_PM_SUPPORT_DEADLINE)
+/*
+ * Find the deepest power state allowed by the constraints among toleratedState and the shallower states, and whose exit
+ * latency is smaller than duration if duration is not 0. The optional resources of this state are stored into the soft
+ * constraints. Return 0xFF if toleratedState is not shallower than powerState, or if no state is allowed.
+ */
+static uint8_t PM_FindFallbackState(pm_handle_t *handle, uint8_t toleratedState, uint8_t powerState, uint64_t duration)
+{
+    uint8_t ret = 0xFFU;
+    uint8_t i;
+#if (defined(FSL_PM_SUPPORT_LATENCY_QOS) && FSL_PM_SUPPORT_LATENCY_QOS)
+    uint32_t maxLatency = PM_GetLatencyConstraintByHandle(handle);
+#else
+    uint32_t maxLatency = PM_LATENCY_NO_CONSTRAINT;
+#endif /* FSL_PM_SUPPORT_LATENCY_QOS */
+
+    if (toleratedState < powerState)
+    {
+        for (i = toleratedState + 1U; i >= 1U; i--)
+        {
+            if (((duration == 0U) || (PM_GetExitLatency(handle, (i - 1U)) < duration)) &&
+                (PM_CheckStateConstraints(handle, i - 1U, maxLatency, &handle->softConstraints, NULL) ==
+                 kPM_reason_deepest))
+            {
+                ret = i - 1U;
+                break;
+            }
+        }
+    }
+
+    return ret;
+}
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK || FSL_PM_SUPPORT_DEADLINE */
+
+#if (defined(FSL_PM_SUPPORT_DEADLINE) && FSL_PM_SUPPORT_DEADLINE)
+/*
+ * Return the time left from now until the deadline, 0 if the deadline is reached. The timestamps wrap with the low
+ * power timer counter, so they are not compared directly: the deadline is reached when it is closer behind now than
+ * ahead of it, both distances being measured modulo the counter by getTimerDuration.
+ */
+static uint64_t PM_GetTimeUntilDeadline(pm_handle_t *handle, uint64_t now, uint64_t deadline)
+{
+    uint64_t ahead  = handle->getTimerDuration(now, deadline);
+    uint64_t behind = handle->getTimerDuration(deadline, now);
+
+    return (ahead < behind) ? ahead : 0U;
+}
+
+/*
+ * Called once the policy and the notifiers have run for a PM_EnterLowPowerUntil() request. Update the entry overhead
+ * average, and shorten duration to the time left until the deadline, it may already be shorter if a timed constraint
+ * expires first. If the power state can no longer wake up in time, fall back to a shallower one, the notifiers have
+ * prepared for a deeper state which also covers it.
+ */
+static status_t PM_UpdateDeadline(pm_handle_t *handle, uint8_t *stateIndex, uint64_t *duration)
+{
+    status_t status = kStatus_PMSuccess;
+    uint64_t now    = handle->getTimestamp();
+    uint64_t overhead;
+    uint64_t timeLeft;
+    uint8_t fallbackState;
+
+    overhead              = handle->getTimerDuration(handle->requestTimestamp, now);
+    handle->entryOverhead = handle->entryOverhead - (handle->entryOverhead >> 2U) + (overhead >> 2U);
+
+    timeLeft  = PM_GetTimeUntilDeadline(handle, now, handle->deadline);
+    *duration = MIN(*duration, timeLeft);
+
+    if (*duration == 0U)
+    {
+        status = kStatus_PMPowerStateNotAllowed;
+    }
+    else if (PM_GetExitLatency(handle, *stateIndex) >= *duration)
+    {
+        fallbackState =
+            (*stateIndex != 0U) ? PM_FindFallbackState(handle, *stateIndex - 1U, *stateIndex, *duration) : 0xFFU;
+        if (fallbackState != 0xFFU)
+        {
+            *stateIndex         = fallbackState;
+            handle->targetState = fallbackState;
+        }
+        else
+        {
+            status = kStatus_PMPowerStateNotAllowed;
+        }
+    }
+    else
+    {
+        /* The power state still fits. */
+    }
+
+    return status;
+}
+#endif /* FSL_PM_SUPPORT_DEADLINE */
+
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+/*
+ * Return (value * factor) >> 32 for a Q32.32 factor, with 32-bit partial products so that only the result has to fit
+ * in 64 bits.
+ */
+static uint64_t PM_MultiplyQ32(uint64_t value, uint64_t factor)
+{
+    uint64_t valueHigh  = value >> 32U;
+    uint64_t valueLow   = value & 0xFFFFFFFFULL;
+    uint64_t factorHigh = factor >> 32U;
+    uint64_t factorLow  = factor & 0xFFFFFFFFULL;
+
+    return ((valueHigh * factorHigh) << 32U) + (valueHigh * factorLow) + (valueLow * factorHigh) +
+           ((valueLow * factorLow) >> 32U);
+}
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+
+/*
+ * Enter the power state through the board sequencer. When the low power timer re-arms itself after an intermediate
+ * period of a long duration, go back to the same power state, the application only sees the final wakeup.
+ */
+static void PM_EnterPowerState(pm_handle_t *handle, uint8_t stateIndex)
+{
+    bool reenter;
+
+    do
+    {
+        handle->deviceOption->enter(stateIndex, &handle->softConstraints, &handle->sysRescGroup);
+
+        reenter = false;
+#if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
+        if (handle->timerRearm != NULL)
+        {
+            reenter = handle->timerRearm();
+        }
+#endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
+    } while (reenter);
+}
+
+#if (defined(FSL_PM_SUPPORT_GOVERNOR) && FSL_PM_SUPPORT_GOVERNOR)
+static uint32_t PM_GetBreakEvenTime(pm_handle_t *handle, uint8_t stateIndex)
+{
+    pm_state_t *state = &(handle->deviceOption->states[stateIndex]);
+
+    return (state->breakEvenTime != 0U) ? state->breakEvenTime : PM_GetExitLatency(handle, stateIndex);
+}
+#endif /* FSL_PM_SUPPORT_GOVERNOR */
+
+/*
+ * Default critical section of the handles. PM_EnterCriticalRegion() recognizes it and masks the interrupts itself,
+ * with the previous mask kept in the handle so that the critical sections of several handles nest.
+ */
+static void PM_EnterCriticalDefault(void)
+{
+}
+
+static void PM_ExitCriticalDefault(void)
+{
+}
+
+/*!
+ * Finds the Deepest power state allowed by the current constraints.
+ * Returns a structure that application can use to determine why this
+ * is deepest state allowed. The duration is in the unit of the exit latencies.
+ */
+//ToDo need to submit PR for updated PM_findDeepestState()
+static void PM_SelectDeepestState(pm_handle_t *handle, uint64_t duration, pm_deepest_state_results_t *results)
+{
+    uint8_t ret        = 0xFFU;
+    uint8_t stateCount = (handle->deviceOption->stateCount);
+#if (defined(FSL_PM_SUPPORT_LATENCY_QOS) && FSL_PM_SUPPORT_LATENCY_QOS)
+    uint32_t maxLatency = PM_GetLatencyConstraintByHandle(handle);
+#else
+    uint32_t maxLatency = PM_LATENCY_NO_CONSTRAINT;
+#endif /* FSL_PM_SUPPORT_LATENCY_QOS */
+#if (defined(FSL_PM_SUPPORT_GOVERNOR) && FSL_PM_SUPPORT_GOVERNOR)
+    uint8_t i;
+    uint8_t nextState;
+    pm_governor_input_t input;
+    pm_governor_func_t governor =
+        (handle->governor != NULL) ? handle->governor : PM_GovernorDeepestAllowed;
+
+    /* The constraints give the allowed states, the governor picks one of them */
+    input.allowedStates = 0UL;
+    for (i = 0U; i < stateCount; i++)
+    {
+        if (PM_CheckStateConstraints(handle, i, maxLatency, NULL, NULL) == kPM_reason_deepest)
+        {
+            input.allowedStates |= (1UL << i);
+        }
+    }
+    input.duration      = duration;
+    input.maxLatency    = maxLatency;
+    input.lastState     = handle->lastState;
+    input.lastResidency = handle->lastResidency;
+
+    ret = governor(handle, &input);
+
+    if (ret != 0xFFU)
+    {
+        assert((input.allowedStates & (1UL << ret)) != 0UL);
+        (void)PM_CheckStateConstraints(handle, ret, maxLatency, &handle->softConstraints, NULL);
+    }
+
+    if (ret == (stateCount - 1U))
+    {
+        results->reason = kPM_reason_deepest;
+    }
+    else
+    {
+        /* Report why the next deeper state was not chosen */
+        nextState       = (ret == 0xFFU) ? 0U : (ret + 1U);
+        results->reason = PM_CheckStateConstraints(handle, nextState, maxLatency, NULL, &results->resc_num);
+        if (results->reason == kPM_reason_deepest)
+        {
+            results->reason = ((duration != 0U) && (PM_GetExitLatency(handle, nextState) >= duration)) ?
+                                  kPM_reason_latency :
+                                  kPM_reason_governor;
+        }
+    }
+#else
+    uint8_t i                                   = 0U;
+    pm_deepest_state_reasons_t prev_mode_reason = 0xFF; /* no previous mode yet */
+    pm_deepest_state_reasons_t curr_mode_reason = kPM_reason_deepest;
+
+    for (i = stateCount; i >= 1U; i--)
+    {
+        /*
+         * The next power state's exit latency should be smaller than low power duration.
+         * And the next power state should satisfy the whole system's constraints.
+         */
+        if ((duration != 0U) && (PM_GetExitLatency(handle, (i - 1U)) >= duration))
+        {
+            curr_mode_reason = kPM_reason_latency;
+        }
+        else
+        {
+            curr_mode_reason =
+                PM_CheckStateConstraints(handle, (i - 1U), maxLatency, &handle->softConstraints, &results->resc_num);
+        }
+
+        if (curr_mode_reason == kPM_reason_deepest)
+        {
+            ret = (i - 1U);
+            break;
+        }
+
+        prev_mode_reason = curr_mode_reason;
+    }
+
+    if(ret == (stateCount - 1))
+    {
+        results->reason = kPM_reason_deepest;
+    } else
+    {
+        results->reason = prev_mode_reason;
+    }
+#endif /* FSL_PM_SUPPORT_GOVERNOR */
+    results->deepestState = ret;
+}
+
+/***************************************************************
+ * Public Funtions
+ ***************************************************************/
+/*!
+ * brief Same as PM_findDeepestState(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+void PM_findDeepestStateByHandle(pm_handle_t *handle, uint64_t duration, pm_deepest_state_results_t *results)
+{
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+    duration = PM_TicksToUsByHandle(handle, duration);
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+
+    PM_SelectDeepestState(handle, duration, results);
+}
+
+/*!
+ * Finds the Deepest power state allowed by the current constraints for a duration in low power timer ticks.
+ */
+void PM_findDeepestState(uint64_t duration, pm_deepest_state_results_t *results)
+{
+    PM_findDeepestStateByHandle(s_pmHandle, duration, results);
+}
+
+/*!
+ * brief Initialize a power manager handle, without making it the default handle.
+ *
+ * Each handle is an independent power manager instance with its own constraints, notifiers, wakeup sources and
+ * timer controller. It is used with the ByHandle variants of the APIs, for example one instance per core, or several
+ * simulated devices in one host process. When FSL_PM_SUPPORT_STATIC_TABLES is enabled, the notifier and wakeup source
+ * tables are shared by all the handles.
+ *
+ * note In default, the power manager is disabled.
+ *
+ * param handle Pointer to the pm_handle_t structure, upper layer software should pre-allocate the handle.
+ * param deviceOption Power states and sequences of the device, NULL for the ones of the board.
+ */
+void PM_InitHandle(pm_handle_t *handle, pm_device_option_t *deviceOption)
+{
+    assert(handle != NULL);
+
+    /* Clear handle. */
+    (void)memset(handle, 0, sizeof(*handle));
+
+    handle->enable = false;
+    /* Initial value is set to 1 as Power Manager is disabled by default */
+    handle->disableCount = 1;
+    handle->deviceOption = (deviceOption != NULL) ? deviceOption : &g_devicePMOption;
+#if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
+    handle->timerStart       = NULL;
+    handle->timerStop        = NULL;
+    handle->getTimerDuration = NULL;
+    handle->getTimestamp     = NULL;
+    handle->timerRearm       = NULL;
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+    handle->timeBase = NULL;
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+#endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
+
+    handle->enterCritical = PM_EnterCriticalDefault;
+    handle->exitCritical  = PM_ExitCriticalDefault;
+
+#if (defined(FSL_PM_SUPPORT_GOVERNOR) && FSL_PM_SUPPORT_GOVERNOR)
+    handle->governor  = PM_GovernorDeepestAllowed;
+    handle->lastState = 0xFFU;
+#endif /* FSL_PM_SUPPORT_GOVERNOR */
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+    PM_ENABLE_CYCLE_COUNTER();
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+
+#if !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+#if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
+    /* Create notify lists. */
     LIST_Init((list_handle_t) & (handle->notifyList[kPM_NotifyGroup0]), 0UL);
     LIST_Init((list_handle_t) & (handle->notifyList[kPM_NotifyGroup1]), 0UL);
     LIST_Init((list_handle_t) & (handle->notifyList[kPM_NotifyGroup2]), 0UL);
 #endif /* FSL_PM_SUPPORT_NOTIFICATION */
 
 #if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
-    LIST_Init((list_handle_t) & (handle->wakeupSourceList), 0UL);
-#endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
+    LIST_Init((list_handle_t) & (handle->wakeupSourceList), 0UL);
+#endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+
+#if (defined(FSL_PM_SUPPORT_TIMED_CONSTRAINTS) && FSL_PM_SUPPORT_TIMED_CONSTRAINTS)
+    LIST_Init((list_handle_t) & (handle->timedConstraintList), 0UL);
+#endif /* FSL_PM_SUPPORT_TIMED_CONSTRAINTS */
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_QOS) && FSL_PM_SUPPORT_LATENCY_QOS)
+    LIST_Init((list_handle_t) & (handle->latencyRequestList), 0UL);
+#endif /* FSL_PM_SUPPORT_LATENCY_QOS */
+
+#if (defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES) && \
+    (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
+    PM_InitStaticNotifyTable(handle);
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+
+    /* Need to clean some device register for proper functioning */
+    /*
+     * $Branch Coverage Justification$
+     * $ref pm_core_c_ref_1$.
+     */
+    if (handle->deviceOption->clean != NULL)
+    {
+        handle->deviceOption->clean();
+    }
+
+    PM_SetAllowedLowestPowerMode(handle);
+}
+
+/*!
+ * brief Initialize the power manager handle, this function should be invoked before using other power manager
+ * APIs.
+ *
+ * The handle becomes the default handle, used by the APIs that do not take a handle.
+ *
+ * note In default, the power manager is disabled.
+ *
+ * param handle Pointer to the pm_handle_t structure, upper layer software should pre-allocate the handle global
+ * variable.
+ */
+void PM_CreateHandle(pm_handle_t *handle)
+{
+    PM_InitHandle(handle, NULL);
+
+    s_pmHandle = handle;
+}
+
+/*!
+ * brief Set the default handle, used by the APIs that do not take a handle.
+ *
+ * param handle Pointer to a handle initialized with PM_InitHandle() or PM_CreateHandle().
+ */
+void PM_SetDefaultHandle(pm_handle_t *handle)
+{
+    assert(handle != NULL);
+
+    s_pmHandle = handle;
+}
+
+/*!
+ * brief Get the default handle, used by the APIs that do not take a handle.
+ *
+ * return The default handle, NULL if PM_CreateHandle() was not called.
+ */
+pm_handle_t *PM_GetDefaultHandle(void)
+{
+    return s_pmHandle;
+}
+
+/*!
+ * brief Same as PM_EnablePowerManager(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+void PM_EnablePowerManagerByHandle(pm_handle_t *handle, bool enable)
+{
+    /* Check whether Power Manager has been initialized or not */
+    assert(handle != NULL);
+
+    PM_EnterCriticalRegion(handle);
+
+    if (enable == true)
+    {
+        assert(handle->disableCount > 0);
+
+        handle->disableCount--;
+
+        if (handle->disableCount == 0)
+        {
+            handle->enable = true;
+        }
+    }
+    else
+    {
+        handle->disableCount++;
+
+        if (handle->disableCount >= 1)
+        {
+            handle->enable = false;
+        }
+    }
+
+    PM_ExitCriticalRegion(handle);
+}
+
+/*!
+ * brief Enable/disable power manager functions.
+ *
+ * param enable Used to enable/disable power manager functions.
+ */
+void PM_EnablePowerManager(bool enable)
+{
+    PM_EnablePowerManagerByHandle(s_pmHandle, enable);
+}
+
+/*!
+ * brief Same as PM_EnterLowPower(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+void PM_EnterLowPowerByHandle(pm_handle_t *handle, uint64_t duration)
+{
+    uint8_t stateIndex;
+    status_t status = kStatus_PMPowerStateNotAllowed;
+    pm_deepest_state_results_t results;
+#if (defined(FSL_PM_SUPPORT_LATENCY_CALIBRATION) && FSL_PM_SUPPORT_LATENCY_CALIBRATION)
+    bool calibrate;
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+    uint64_t calibrationTicks;
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+#endif /* FSL_PM_SUPPORT_LATENCY_CALIBRATION */
+
+    if (handle->enable)
+    {
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+        /* The policy works in microseconds, the unit of the exit latencies. */
+        duration = PM_TicksToUsByHandle(handle, duration);
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+
+#if (defined(FSL_PM_SUPPORT_TIMED_CONSTRAINTS) && FSL_PM_SUPPORT_TIMED_CONSTRAINTS)
+        /* Release the expired timed constraints, and wake up when the next one expires. */
+        duration = PM_UpdateTimedConstraints(handle, duration);
+#endif /* FSL_PM_SUPPORT_TIMED_CONSTRAINTS */
+
+        /* 1. Based on duration and system constraints compute the next allowed deepest power state. */
+        PM_SelectDeepestState(handle, duration, &results);
+        stateIndex = results.deepestState;
+
+        if (stateIndex != 0xFFU)
+        {
+            handle->targetState = stateIndex;
+            status              = kStatus_PMSuccess;
+
+#if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
+            /* Notify the enter of power state */
+            status = PM_notifyPowerStateEntry(handle, stateIndex);
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK)
+            /* A notifier may have made the power manager fall back to a shallower state. */
+            stateIndex = handle->targetState;
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK */
+#endif /* FSL_PM_SUPPORT_NOTIFICATION */
+
+#if (defined(FSL_PM_SUPPORT_DEADLINE) && FSL_PM_SUPPORT_DEADLINE)
+            /* The policy and the notifiers took some time, compute again the time left until the deadline. */
+            if ((status == kStatus_PMSuccess) && handle->deadlineRequested)
+            {
+                status = PM_UpdateDeadline(handle, &stateIndex, &duration);
+            }
+#endif /* FSL_PM_SUPPORT_DEADLINE */
+
+            if (status == kStatus_PMSuccess)
+            {
+#if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
+                if (handle->getTimestamp != NULL)
+                {
+                    handle->entryTimestamp = handle->getTimestamp();
+                }
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_CALIBRATION) && FSL_PM_SUPPORT_LATENCY_CALIBRATION)
+                calibrate = PM_StartLatencyCalibration(handle, stateIndex, duration);
+                if (calibrate)
+                {
+                    /*
+                     * Sleep for a very short time to measure how late the execution resumes. The period starts
+                     * before the timer is started, and is the one the timer counts once rounded to its ticks.
+                     */
+                    handle->calibrationTimestamp = handle->latencyGetTimestamp();
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+                    calibrationTicks          = PM_UsToTicksByHandle(handle, handle->calibrationPeriod);
+                    handle->calibrationPeriod = (uint32_t)PM_TicksToUsByHandle(handle, calibrationTicks);
+                    handle->timerStart(calibrationTicks);
+#else
+                    handle->timerStart(handle->calibrationPeriod);
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+                }
+                else
+#endif /* FSL_PM_SUPPORT_LATENCY_CALIBRATION */
+                /* Start low power timer if needed */
+                if (handle->timerStart != NULL)
+                {
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+                    handle->timerStart(PM_UsToTicksByHandle(handle, duration - PM_GetExitLatency(handle, stateIndex)));
+#else
+                    handle->timerStart(duration - PM_GetExitLatency(handle, stateIndex));
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+                }
+#endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
+
+                /* Enter into low power state. */
+                PM_EnterPowerState(handle, stateIndex);
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_CALIBRATION) && FSL_PM_SUPPORT_LATENCY_CALIBRATION)
+                if (calibrate)
+                {
+                    PM_EndLatencyCalibration(handle, stateIndex);
+                }
+#endif /* FSL_PM_SUPPORT_LATENCY_CALIBRATION */
+
+#if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
+                /* Stop low power timer if it is started */
+                if (handle->timerStop != NULL)
+                {
+                    handle->timerStop();
+                }
+
+                if (handle->getTimestamp != NULL)
+                {
+                    handle->exitTimestamp = handle->getTimestamp();
+                }
+#endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
+
+#if (defined(FSL_PM_SUPPORT_GOVERNOR) && FSL_PM_SUPPORT_GOVERNOR)
+                /* Keep the history used by the governor */
+                handle->lastState     = stateIndex;
+                handle->lastResidency = 0U;
+#if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
+                if ((handle->getTimestamp != NULL) && (handle->getTimerDuration != NULL))
+                {
+                    handle->lastResidency = handle->getTimerDuration(handle->entryTimestamp, handle->exitTimestamp);
+                }
+#endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
+#endif /* FSL_PM_SUPPORT_GOVERNOR */
+            }
+
+#if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
+            /* Notify the exit of power state. */
+            (void)PM_notifyPowerStateExit(handle, stateIndex);
+#endif /* FSL_PM_SUPPORT_NOTIFICATION */
+
+            /*
+             * $Branch Coverage Justification$
+             * $ref pm_core_c_ref_1$.
+             */
+            if (handle->deviceOption->clean != NULL)
+            {
+                handle->deviceOption->clean();
+            }
+        }
+    }
+
+#if (defined(FSL_PM_SUPPORT_DEADLINE) && FSL_PM_SUPPORT_DEADLINE)
+    handle->entryStatus = status;
+#endif /* FSL_PM_SUPPORT_DEADLINE */
+}
+
+/*!
+ * brief Power manager core API, this API should be used on RTOS's IDLE task.
+ *
+ * This function contains several steps:
+ * 1. Compute target power state based on the policy module.
+ * 2. Notify upper layer software of the power mode entering.
+ * 3. Enter into target power state.
+ * 4. Exit from low power state, if wakeup event occurred.
+ * 5. Notify upper layer software of the power mode exiting.
+ *
+ * The target power state is determined based on two factors:
+ *   a. The input parameter should be larger than state's exitLatency attribution.
+ *   b. resConstraintsMask logical AND state's lossFeature should equal to 0, because constraint can be understand as
+ * some features can not loss.
+ *
+ * param duration The time in low power mode, this value is calculate from RTOS API. In low power timer ticks
+ *                 when a time base is registered with PM_RegisterTimeBase().
+ */
+void PM_EnterLowPower(uint64_t duration)
+{
+    PM_EnterLowPowerByHandle(s_pmHandle, duration);
+}
+
+#if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
+/*!
+ * brief Register timer controller related functions to power manager.
+ *
+ * If low power timer is the wakeup source, please remember to register it into power manager by using
+ * PM_RegisterWakeupSource() function.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ * param timerStart Low power timer start function, this parameter can be NULL, and it means low power timer is not set
+ *  as the wakeup source.
+ * param timerStop Low power timer stop function, this parameter can also be set as NULL.
+ * param timerSync Low power timer sync function, this parameter can also be set as NULL.
+ * param getTimestamp Low power timestamp function, this parameter can also be set as NULL.
+ * param getTimerDuration Get timer count function. this parameter can also be set as NULL.
+ */
+void PM_RegisterTimerController(pm_handle_t *handle,
+                                pm_low_power_timer_start_func_t timerStart,
+                                pm_low_power_timer_stop_func_t timerStop,
+                                pm_low_power_timer_get_timestamp_func_t getTimestamp,
+                                pm_low_power_timer_get_duration_func_t getTimerDuration)
+{
+    assert(handle != NULL);
+
+    PM_EnterCriticalRegion(handle);
+
+    handle->timerStart       = timerStart;
+    handle->timerStop        = timerStop;
+    handle->getTimerDuration = getTimerDuration;
+    handle->getTimestamp     = getTimestamp;
+
+    PM_ExitCriticalRegion(handle);
+}
+
+/*!
+ * brief Register the re-arm function of the low power timer.
+ *
+ * A low power timer that cannot cover the requested duration in one period wakes the device up at the end of each
+ * intermediate period. The re-arm function is called after each wakeup with the interrupts masked, it returns true
+ * when the wakeup was caused by such an intermediate period and the timer is running again. The low power state is
+ * then entered again without notifying the exit.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ * param timerRearm Low power timer re-arm function, NULL when the timer always covers the duration in one period.
+ */
+void PM_RegisterTimerRearm(pm_handle_t *handle, pm_low_power_timer_rearm_func_t timerRearm)
+{
+    assert(handle != NULL);
+
+    PM_EnterCriticalRegion(handle);
+
+    handle->timerRearm = timerRearm;
+
+    PM_ExitCriticalRegion(handle);
+}
+
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+/*!
+ * brief Register the time base of the low power timer.
+ *
+ * Once registered, the durations given to PM_EnterLowPower() and PM_findDeepestState() and given to the timerStart
+ * function are in ticks of the low power timer. The policy converts them to microseconds, the unit of the exit
+ * latencies, of the latency QoS requests, of the timed constraint delays and of the getTimerDuration function.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ * param timeBase Pointer to the time base, usually initialized with PM_TIME_BASE_INIT(). NULL disables the conversions.
+ */
+void PM_RegisterTimeBase(pm_handle_t *handle, const pm_time_base_t *timeBase)
+{
+    assert(handle != NULL);
+
+    PM_EnterCriticalRegion(handle);
+
+    handle->timeBase = timeBase;
+
+    PM_ExitCriticalRegion(handle);
+}
+
+/*!
+ * brief Same as PM_TicksToUs(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+uint64_t PM_TicksToUsByHandle(pm_handle_t *handle, uint64_t ticks)
+{
+    return (handle->timeBase != NULL) ? PM_MultiplyQ32(ticks, handle->timeBase->ticksToUs) : ticks;
+}
+
+/*!
+ * brief Convert low power timer ticks to microseconds with the registered time base.
+ *
+ * param ticks Number of ticks.
+ * return The number of microseconds rounded down, ticks if no time base is registered.
+ */
+uint64_t PM_TicksToUs(uint64_t ticks)
+{
+    return PM_TicksToUsByHandle(s_pmHandle, ticks);
+}
+
+/*!
+ * brief Same as PM_UsToTicks(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+uint64_t PM_UsToTicksByHandle(pm_handle_t *handle, uint64_t us)
+{
+    return (handle->timeBase != NULL) ? PM_MultiplyQ32(us, handle->timeBase->usToTicks) : us;
+}
+
+/*!
+ * brief Convert microseconds to low power timer ticks with the registered time base.
+ *
+ * param us Number of microseconds.
+ * return The number of ticks rounded down, us if no time base is registered.
+ */
+uint64_t PM_UsToTicks(uint64_t us)
+{
+    return PM_UsToTicksByHandle(s_pmHandle, us);
+}
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+
+/*!
+ * brief Enter the critical region of a power manager instance.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+void PM_EnterCriticalRegion(pm_handle_t *handle)
+{
+    if (handle->enterCritical == PM_EnterCriticalDefault)
+    {
+        handle->criticalMask = DisableGlobalIRQ();
+    }
+    else if (handle->enterCritical != NULL)
+    {
+        handle->enterCritical();
+    }
+    else
+    {
+        /* No critical region */
+    }
+}
+
+/*!
+ * brief Exit the critical region of a power manager instance.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+void PM_ExitCriticalRegion(pm_handle_t *handle)
+{
+    if (handle->exitCritical == PM_ExitCriticalDefault)
+    {
+        EnableGlobalIRQ(handle->criticalMask);
+    }
+    else if (handle->exitCritical != NULL)
+    {
+        handle->exitCritical();
+    }
+    else
+    {
+        /* No critical region */
+    }
+}
+
+void PM_RegisterCriticalRegionController(pm_handle_t *handle,
+                                         pm_enter_critical criticalEntry,
+                                         pm_exit_critical criticalExit)
+{
+    assert(handle != NULL);
+
+    handle->enterCritical = criticalEntry;
+    handle->exitCritical  = criticalExit;
+}
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_CALIBRATION) && FSL_PM_SUPPORT_LATENCY_CALIBRATION)
+/*!
+ * brief Register latency calibration related functions. Those functions must use microseconds as unit.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ * param latencyGetTimestamp Timestamping function used by the latency calibration.
+ * param latencyGetDuration Function used to compute the duration between two timestamps.
+ */
+void PM_RegisterLatencyCalibrationController(pm_handle_t *handle,
+                                             pm_latency_get_timestamp_func_t latencyGetTimestamp,
+                                             pm_latency_get_duration_func_t latencyGetDuration)
+{
+    assert(handle != NULL);
+
+    handle->latencyGetTimestamp = latencyGetTimestamp;
+    handle->latencyGetDuration  = latencyGetDuration;
+}
+
+/*!
+ * brief Same as PM_RequestLatencyCalibration(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+void PM_RequestLatencyCalibrationByHandle(pm_handle_t *handle)
+{
+    handle->calibrationAttempts  = 0U;
+    handle->calibrationRequested = true;
+}
+
+/*!
+ * brief Request a latency calibration, done on next low power entry for the target power state.
+ */
+void PM_RequestLatencyCalibration(void)
+{
+    PM_RequestLatencyCalibrationByHandle(s_pmHandle);
+}
+
+/*!
+ * brief Same as PM_SetSoftwareExitLatency(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+void PM_SetSoftwareExitLatencyByHandle(pm_handle_t *handle, uint8_t stateIndex, uint32_t exitLatency)
+{
+    assert(stateIndex < handle->deviceOption->stateCount);
+
+    PM_EnterCriticalRegion(handle);
+
+    handle->exitLatency[stateIndex] = exitLatency;
+    handle->calibratedStates |= (1UL << stateIndex);
+
+    PM_ExitCriticalRegion(handle);
+}
+
+/*!
+ * brief Force the exit latency used by the policy for one power state.
+ *
+ * param stateIndex Power state concerned by this latency.
+ * param exitLatency Exit latency estimated by the software, in us.
+ */
+void PM_SetSoftwareExitLatency(uint8_t stateIndex, uint32_t exitLatency)
+{
+    PM_SetSoftwareExitLatencyByHandle(s_pmHandle, stateIndex, exitLatency);
+}
+#endif /* FSL_PM_SUPPORT_LATENCY_CALIBRATION */
+
+#if (defined(FSL_PM_SUPPORT_GOVERNOR) && FSL_PM_SUPPORT_GOVERNOR)
+/*!
+ * brief Register the governor used to choose the power state, it can be changed at any time.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ * param governor Governor function, such as PM_GovernorDeepestAllowed(), PM_GovernorEnergyBreakEven() or
+ *                PM_GovernorLadder().
+ *                NULL restores PM_GovernorDeepestAllowed().
+ */
+void PM_RegisterGovernor(pm_handle_t *handle, pm_governor_func_t governor)
+{
+    assert(handle != NULL);
+
+    handle->governor    = (governor != NULL) ? governor : PM_GovernorDeepestAllowed;
+    handle->ladderState = 0U;
+    handle->ladderCount = 0U;
+}
+
+/*!
+ * brief Governor choosing the deepest allowed power state that exits within the duration.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ * param input Pointer to the governor inputs.
+ * return The index of the power state to enter, or 0xFF.
+ */
+uint8_t PM_GovernorDeepestAllowed(pm_handle_t *handle, const pm_governor_input_t *input)
+{
+    uint8_t i;
+    uint8_t ret = 0xFFU;
+
+    for (i = handle->deviceOption->stateCount; i >= 1U; i--)
+    {
+        if (((input->allowedStates & (1UL << (i - 1U))) != 0UL) &&
+            ((input->duration == 0U) || (PM_GetExitLatency(handle, i - 1U) < input->duration)))
+        {
+            ret = i - 1U;
+            break;
+        }
+    }
+
+    return ret;
+}
+
+/*!
+ * brief Governor choosing the deepest allowed power state whose break-even time fits in the duration.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ * param input Pointer to the governor inputs.
+ * return The index of the power state to enter, or 0xFF.
+ */
+uint8_t PM_GovernorEnergyBreakEven(pm_handle_t *handle, const pm_governor_input_t *input)
+{
+    uint8_t i;
+    uint8_t ret         = 0xFFU;
+    uint64_t prediction = (input->duration != 0U) ? input->duration : input->lastResidency;
+
+    for (i = handle->deviceOption->stateCount; i >= 1U; i--)
+    {
+        /* The exit latency is a hard limit, the break-even time only applies to a known or predicted residency */
+        if (((input->allowedStates & (1UL << (i - 1U))) != 0UL) &&
+            ((input->duration == 0U) || (PM_GetExitLatency(handle, i - 1U) < input->duration)) &&
+            ((prediction == 0U) || (PM_GetBreakEvenTime(handle, i - 1U) <= prediction)))
+        {
+            ret = i - 1U;
+            break;
+        }
+    }
+
+    return ret;
+}
+
+/*!
+ * brief Governor climbing the power states one step at a time, to avoid thrashing under periodic wakeups.
+ *
+ * param handle Pointer to the pm_handle_t structure, it holds the ladder counters.
+ * param input Pointer to the governor inputs.
+ * return The index of the power state to enter, or 0xFF.
+ */
+uint8_t PM_GovernorLadder(pm_handle_t *handle, const pm_governor_input_t *input)
+{
+    uint8_t i;
+    uint8_t ret = 0xFFU;
+
+    if (input->lastResidency == 0U)
+    {
+        /* No history to climb on */
+        ret = PM_GovernorDeepestAllowed(handle, input);
+    }
+    else
+    {
+        /* The ladder never climbs above the deepest state allowed by the constraints */
+        while ((handle->ladderState > 0U) && ((input->allowedStates >> handle->ladderState) == 0UL))
+        {
+            handle->ladderState--;
+        }
+
+        if (input->lastResidency < PM_GetBreakEvenTime(handle, handle->ladderState))
+        {
+            /* Too short for the current step: demote at once to the deepest step it would have paid for */
+            while ((handle->ladderState > 0U) &&
+                   (input->lastResidency < PM_GetBreakEvenTime(handle, handle->ladderState)))
+            {
+                handle->ladderState--;
+            }
+            handle->ladderCount = 0U;
+        }
+        else if (((input->allowedStates >> (handle->ladderState + 1U)) != 0UL) &&
+                 (input->lastResidency >= PM_GetBreakEvenTime(handle, handle->ladderState + 1U)))
+        {
+            /* Long enough for the next step, promote after enough consecutive ones */
+            handle->ladderCount++;
+            if (handle->ladderCount >= PM_GOVERNOR_LADDER_PROMOTE_COUNT)
+            {
+                handle->ladderState++;
+                handle->ladderCount = 0U;
+            }
+        }
+        else
+        {
+            handle->ladderCount = 0U;
+        }
+
+        /* The deepest allowed state not deeper than the ladder step */
+        for (i = handle->ladderState + 1U; i >= 1U; i--)
+        {
+            if (((input->allowedStates & (1UL << (i - 1U))) != 0UL) &&
+                ((input->duration == 0U) || (PM_GetExitLatency(handle, i - 1U) < input->duration)))
+            {
+                ret = i - 1U;
+                break;
+            }
+        }
+    }
+
+    return ret;
+}
+#endif /* FSL_PM_SUPPORT_GOVERNOR */
+
+/*!
+ * brief Same as PM_GetLastLowPowerDuration(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+uint64_t PM_GetLastLowPowerDurationByHandle(pm_handle_t *handle)
+{
+    uint64_t duration = 0U;
+
+    if (handle->getTimerDuration != NULL)
+    {
+        duration = handle->getTimerDuration(handle->entryTimestamp, handle->exitTimestamp);
+    }
+
+    return duration;
+}
+
+/*!
+ * brief Get the actual low power state duration.
+ */
+uint64_t PM_GetLastLowPowerDuration(void)
+{
+    return PM_GetLastLowPowerDurationByHandle(s_pmHandle);
+}
+
+#if (defined(FSL_PM_SUPPORT_DEADLINE) && FSL_PM_SUPPORT_DEADLINE)
+/*!
+ * brief Same as PM_EnterLowPowerUntil(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+status_t PM_EnterLowPowerUntilByHandle(pm_handle_t *handle, uint64_t deadline)
+{
+    status_t status = kStatus_PMPowerStateNotAllowed;
+    uint64_t now;
+    uint64_t duration;
+
+    assert(handle->getTimestamp != NULL);
+    assert(handle->getTimerDuration != NULL);
+
+    now      = handle->getTimestamp();
+    duration = PM_GetTimeUntilDeadline(handle, now, deadline);
+    if (duration != 0U)
+    {
+        /* Choose the power state for the time left once the policy and the notifiers have run. */
+        duration = (duration > handle->entryOverhead) ? (duration - handle->entryOverhead) : 1U;
+
+        handle->deadline          = deadline;
+        handle->requestTimestamp  = now;
+        handle->deadlineRequested = true;
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+        /* getTimerDuration gives microseconds, PM_EnterLowPower() takes ticks. */
+        duration = PM_UsToTicksByHandle(handle, duration);
+        duration = (duration != 0U) ? duration : 1U;
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+        PM_EnterLowPowerByHandle(handle, duration);
+        handle->deadlineRequested = false;
+        status                    = handle->entryStatus;
+    }
+
+    return status;
+}
+
+/*!
+ * brief Enter low power until an absolute deadline.
+ *
+ * Same as PM_EnterLowPower(), with the duration computed from the deadline with the getTimestamp and
+ * getTimerDuration functions of the timer controller. The power state is chosen for the duration left once the
+ * measured entry overhead is removed. Just before the low power timer is started, the remaining time is computed
+ * again, and a shallower power state is entered if the chosen one can no longer wake up in time.
+ *
+ * param deadline Timestamp at which the execution must resume.
+ * return kStatus_PMSuccess if a power state was entered, kStatus_PMPowerStateNotAllowed if the deadline is already
+ *         reached, the power manager is disabled or no power state can wake up in time, or the error returned by the
+ *         notifiers.
+ */
+status_t PM_EnterLowPowerUntil(uint64_t deadline)
+{
+    return PM_EnterLowPowerUntilByHandle(s_pmHandle, deadline);
+}
+#endif /* FSL_PM_SUPPORT_DEADLINE */
+#endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
+
+#if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
+#if !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+/*!
+ * brief Same as PM_RegisterNotify(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+status_t PM_RegisterNotifyByHandle(pm_handle_t *handle, pm_notify_group_t groupId, pm_notify_element_t *notifyElement)
+{
+    assert(notifyElement != NULL);
+
+    status_t status = kStatus_PMSuccess;
+    list_status_t listStatus;
+#if (defined(FSL_PM_SUPPORT_NOTIFY_PRIORITY) && FSL_PM_SUPPORT_NOTIFY_PRIORITY)
+    pm_notify_element_t *nextElement;
+#endif /* FSL_PM_SUPPORT_NOTIFY_PRIORITY */
+
+    PM_EnterCriticalRegion(handle);
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+    if (notifyElement->stateMask == 0UL)
+    {
+        notifyElement->stateMask = PM_NOTIFY_ALL_STATES;
+    }
+#endif /* FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_PRIORITY) && FSL_PM_SUPPORT_NOTIFY_PRIORITY)
+    /* Insert before the first notifier of lower priority. */
+    nextElement = (pm_notify_element_t *)(void *)(handle->notifyList[groupId].head);
+    while ((nextElement != NULL) && (nextElement->priority <= notifyElement->priority))
+    {
+        nextElement = (pm_notify_element_t *)(void *)(nextElement->link.next);
+    }
+
+    if (nextElement != NULL)
+    {
+        listStatus = LIST_AddPrevElement((list_element_handle_t) & (nextElement->link),
+                                         (list_element_handle_t) & (notifyElement->link));
+    }
+    else
+#endif /* FSL_PM_SUPPORT_NOTIFY_PRIORITY */
+    {
+        listStatus = LIST_AddTail((list_handle_t) & (handle->notifyList[groupId]),
+                                  (list_element_handle_t) & (notifyElement->link));
+    }
+
+    if (listStatus != kLIST_Ok)
+    {
+        status = kStatus_PMFail;
+    }
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+    else
+    {
+        PM_UpdateNotifyLatencyBudget(handle, notifyElement, true);
+    }
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+
+    PM_ExitCriticalRegion(handle);
+
+    return status;
+}
+
+/*!
+ * brief Register notify element into the selected group.
+ *
+ * param groupId The group of the notify list, this will affect the execution sequence.
+ * param notifyElement The pointer to pm_notify_element_t.
+ * return status_t The status of register notify object behavior.
+ */
+status_t PM_RegisterNotify(pm_notify_group_t groupId, pm_notify_element_t *notifyElement)
+{
+    return PM_RegisterNotifyByHandle(s_pmHandle, groupId, notifyElement);
+}
+
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+
+/*!
+ * brief Same as PM_UpdateNotify(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+void PM_UpdateNotifyByHandle(pm_handle_t *handle, void *notifyElement, pm_notify_callback_func_t callback, void *data)
+{
+    PM_EnterCriticalRegion(handle);
+
+    ((pm_notify_element_t *)notifyElement)->data           = data;
+    ((pm_notify_element_t *)notifyElement)->notifyCallback = callback;
+
+    PM_ExitCriticalRegion(handle);
+}
+
+/*!
+ * brief Update notify element's callback function and application data.
+ *
+ * param notifyElement The pointer to the notify element to update.
+ * param callback The callback function to be updated.
+ * param data Pointer to the callback function private data.
+ */
+void PM_UpdateNotify(void *notifyElement, pm_notify_callback_func_t callback, void *data)
+{
+    PM_UpdateNotifyByHandle(s_pmHandle, notifyElement, callback, data);
+}
+
+#if !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+/*!
+ * brief Same as PM_UnregisterNotify(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+status_t PM_UnregisterNotifyByHandle(pm_handle_t *handle, void *notifyElement)
+{
+    status_t status = kStatus_PMSuccess;
+
+    PM_EnterCriticalRegion(handle);
+
+    if (LIST_RemoveElement((list_element_handle_t) & (((pm_notify_element_t *)notifyElement)->link)) != kLIST_Ok)
+    {
+        status = kStatus_PMFail;
+    }
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+    else
+    {
+        PM_UpdateNotifyLatencyBudget(handle, (pm_notify_element_t *)notifyElement, false);
+    }
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+
+#if (defined(FSL_PM_SUPPORT_DEFERRED_NOTIFY) && FSL_PM_SUPPORT_DEFERRED_NOTIFY)
+    /* A removed notifier is no longer notified, drop its pending exit callback. */
+    if ((status == kStatus_PMSuccess) && ((pm_notify_element_t *)notifyElement)->exitPending)
+    {
+        ((pm_notify_element_t *)notifyElement)->exitPending = false;
+        handle->deferredNotifyCount--;
+    }
+#endif /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
+
+    PM_ExitCriticalRegion(handle);
+
+    return status;
+}
+
+/*!
+ * brief Remove notify element from its notify group.
+ *
+ * param notifyElement The pointer to the notify element to remove.
+ */
+status_t PM_UnregisterNotify(void *notifyElement)
+{
+    return PM_UnregisterNotifyByHandle(s_pmHandle, notifyElement);
+}
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+/*!
+ * brief Get the average execution time of a notifier callback.
+ *
+ * param timing Pointer to the entryTiming or exitTiming member of a notify element.
+ * return The average execution time in CPU cycles, 0 if the callback never ran.
+ */
+uint32_t PM_GetNotifyAverageCycles(const pm_notify_timing_t *timing)
+{
+    assert(timing != NULL);
+
+    uint32_t average = 0U;
+
+    if (timing->count != 0U)
+    {
+        average = (uint32_t)(timing->totalCycles / timing->count);
+    }
+
+    return average;
+}
+
+/*!
+ * brief Same as PM_ResetNotifyTiming(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+void PM_ResetNotifyTimingByHandle(pm_handle_t *handle, pm_notify_element_t *notifyElement)
+{
+    assert(notifyElement != NULL);
+
+    PM_EnterCriticalRegion(handle);
+
+    (void)memset(&notifyElement->entryTiming, 0, sizeof(pm_notify_timing_t));
+    (void)memset(&notifyElement->exitTiming, 0, sizeof(pm_notify_timing_t));
+    notifyElement->budgetOverrunCount = 0U;
+
+    PM_ExitCriticalRegion(handle);
+}
+
+/*!
+ * brief Clear the timing statistics and the budget overrun count of a notify element.
+ *
+ * param notifyElement The pointer to the notify element.
+ */
+void PM_ResetNotifyTiming(pm_notify_element_t *notifyElement)
+{
+    PM_ResetNotifyTimingByHandle(s_pmHandle, notifyElement);
+}
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+
+#if (defined(FSL_PM_SUPPORT_DEFERRED_NOTIFY) && FSL_PM_SUPPORT_DEFERRED_NOTIFY)
+/*!
+ * brief Same as PM_RunDeferredNotify(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+void PM_RunDeferredNotifyByHandle(pm_handle_t *handle)
+{
+    pm_notify_element_t *notifyElement;
+
+    do
+    {
+        /* Only taking the element is protected, the callback runs with the interrupts enabled. */
+        PM_EnterCriticalRegion(handle);
+
+        notifyElement = PM_TakeDeferredNotify(handle);
+
+        PM_ExitCriticalRegion(handle);
+
+        if (notifyElement != NULL)
+        {
+            PM_callNotifyExit(notifyElement, handle->deferredNotifyState);
+        }
+    } while (notifyElement != NULL);
+}
+
+/*!
+ * brief Run the pending exit callbacks of the deferred notifiers, in the exit order.
+ *
+ * This function should be called from thread context once the latency critical wakeup handling is done. Each
+ * pending callback runs once, and the pending callbacks left are run before the next power state entry.
+ */
+void PM_RunDeferredNotify(void)
+{
+    PM_RunDeferredNotifyByHandle(s_pmHandle);
+}
+
+/*!
+ * brief Same as PM_RunDeferredNotifyElement(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+bool PM_RunDeferredNotifyElementByHandle(pm_handle_t *handle, pm_notify_element_t *notifyElement)
+{
+    assert(notifyElement != NULL);
+
+    bool pending;
+
+    PM_EnterCriticalRegion(handle);
+
+    pending = notifyElement->exitPending;
+    if (pending)
+    {
+        notifyElement->exitPending = false;
+        handle->deferredNotifyCount--;
+    }
+
+    PM_ExitCriticalRegion(handle);
+
+    if (pending)
+    {
+        PM_callNotifyExit(notifyElement, handle->deferredNotifyState);
+    }
+
+    return pending;
+}
+
+/*!
+ * brief Run the exit callback of a deferred notifier if it is pending.
+ *
+ * A driver can call this function before its first access to the peripheral after a wakeup.
+ *
+ * param notifyElement The pointer to the notify element.
+ * return true if the exit callback was run.
+ */
+bool PM_RunDeferredNotifyElement(pm_notify_element_t *notifyElement)
+{
+    return PM_RunDeferredNotifyElementByHandle(s_pmHandle, notifyElement);
+}
+#endif /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
+#endif /* FSL_PM_SUPPORT_NOTIFICATION */
+
+#if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
+/*!
+ * brief Same as PM_InitWakeupSource(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+void PM_InitWakeupSourceByHandle(pm_handle_t *handle,
+                                 pm_wakeup_source_t *ws,
+                                 uint32_t wsId,
+                                 pm_wake_up_source_service_func_t service,
+                                 bool enable)
+{
+    assert(ws != NULL);
 
-    s_pmHandle = handle;
+    PM_EnterCriticalRegion(handle);
 
-    /* Need to clean some device register for proper functioning */
-    /*
-     * $Branch Coverage Justification$
-     * $ref pm_core_c_ref_1$.
-     */
-    if (s_pmHandle->deviceOption->clean != NULL)
+    ws->wsId    = wsId;
+    ws->service = service;
+    ws->enabled = enable;
+    ws->active  = false;
+
+#if !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+    if (enable == true)
+    {
+        (void)LIST_AddTail((list_handle_t) & (handle->wakeupSourceList), (list_element_handle_t) & (ws->link));
+    }
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+
+    (void)(handle->deviceOption->manageWakeupSource(ws, enable));
+
+    PM_ExitCriticalRegion(handle);
+}
+
+/*!
+ * brief Initialize the wakeup source object.
+ *
+ * param ws    Pointer to the pm_wakeup_source_t variable.
+ * param wsId  Used to select the wakeup source, the wsId of each wakeup source can be found in fsl_pm_board.h
+ * param service The function to be invoked when wake up source asserted.
+ * param enable Used to enable/disable the selected wakeup source.
+ */
+void PM_InitWakeupSource(pm_wakeup_source_t *ws, uint32_t wsId, pm_wake_up_source_service_func_t service, bool enable)
+{
+    PM_InitWakeupSourceByHandle(s_pmHandle, ws, wsId, service, enable);
+}
+
+/*!
+ * brief Same as PM_EnableWakeupSource(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+status_t PM_EnableWakeupSourceByHandle(pm_handle_t *handle, pm_wakeup_source_t *ws)
+{
+    assert(ws != NULL);
+
+    status_t status = kStatus_PMSuccess;
+
+    PM_EnterCriticalRegion(handle);
+
+    if (!(ws->enabled))
+    {
+#if !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+        /* Add wake up source to list so PM can parse the list if wake up event
+         * occurs, and trigger the service callback if needed */
+        (void)LIST_AddTail((list_handle_t) & (handle->wakeupSourceList), (list_element_handle_t) & (ws->link));
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+        status = handle->deviceOption->manageWakeupSource(ws, true);
+
+        if (status == kStatus_Success)
+        {
+            ws->enabled = true;
+        }
+        else
+        {
+            /*
+             * $Line Coverage Justification$
+             * $ref pm_core_c_ref_2$.
+             */
+            status = kStatus_PMWakeupSourceEnableError;
+        }
+    }
+
+    PM_ExitCriticalRegion(handle);
+
+    return status;
+}
+
+/*!
+ * brief Enable wakeup source.
+ *
+ * param ws Pointer to the wakeup source object to be enabled.
+ * return status_t The status of enable wakeup source behavior.
+ */
+status_t PM_EnableWakeupSource(pm_wakeup_source_t *ws)
+{
+    return PM_EnableWakeupSourceByHandle(s_pmHandle, ws);
+}
+
+/*!
+ * brief Same as PM_DisableWakeupSource(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+status_t PM_DisableWakeupSourceByHandle(pm_handle_t *handle, pm_wakeup_source_t *ws)
+{
+    assert(ws != NULL);
+
+    status_t status = kStatus_PMSuccess;
+
+    PM_EnterCriticalRegion(handle);
+
+    if (ws->enabled)
+    {
+#if !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+        /* Remove the wake up source from the list */
+        (void)LIST_RemoveElement((list_element_handle_t) & (ws->link));
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+        status = handle->deviceOption->manageWakeupSource(ws, false);
+
+        if (status == kStatus_Success)
+        {
+            ws->enabled = false;
+        }
+        else
+        {
+            /*
+             * $Line Coverage Justification$
+             * $ref pm_core_c_ref_2$.
+             */
+            status = kStatus_PMWakeupSourceDisableError;
+        }
+    }
+
+    PM_ExitCriticalRegion(handle);
+
+    return status;
+}
+
+/*!
+ * brief Disable wakeup source
+ *
+ * param ws Pointer to the wakeup source object to be disabled.
+ * return status_t The status of disable wakeup source behavior.
+ */
+status_t PM_DisableWakeupSource(pm_wakeup_source_t *ws)
+{
+    return PM_DisableWakeupSourceByHandle(s_pmHandle, ws);
+}
+
+/*!
+ * brief Same as PM_HandleWakeUpEvent(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+status_t PM_HandleWakeUpEventByHandle(pm_handle_t *handle)
+{
+    status_t status = kStatus_PMSuccess;
+    pm_wakeup_source_t *currWakeUpSource;
+
+#if (defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+    /* The table holds all the wakeup sources, the disabled ones are skipped. */
+    for (currWakeUpSource = __pm_wakeup_source_table_start__; currWakeUpSource != __pm_wakeup_source_table_end__;
+         currWakeUpSource++)
+    {
+        if ((currWakeUpSource->enabled) && (currWakeUpSource->service != NULL))
+        {
+            if (handle->deviceOption->isWakeupSource(currWakeUpSource) == true)
+            {
+                status = PM_TriggerWakeSourceServiceByHandle(handle, currWakeUpSource);
+            }
+        }
+    }
+#else
+    if (LIST_GetSize((list_handle_t) & (handle->wakeupSourceList)) != 0UL)
     {
-        s_pmHandle->deviceOption->clean();
+        currWakeUpSource = (pm_wakeup_source_t *)(void *)(handle->wakeupSourceList.head);
+
+        /* the list should contain only enabled ws */
+        assert(currWakeUpSource->enabled == true);
+
+        do
+        {
+            if (currWakeUpSource->service != NULL)
+            {
+                if (handle->deviceOption->isWakeupSource(currWakeUpSource) == true)
+                {
+                    /* The wake up source trigger the last wake up event
+                     * we can call the callback */
+                    status = PM_TriggerWakeSourceServiceByHandle(handle, currWakeUpSource);
+                }
+            }
+
+            currWakeUpSource = (pm_wakeup_source_t *)(void *)currWakeUpSource->link.next;
+        } while (currWakeUpSource != NULL);
     }
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
 
-    PM_SetAllowedLowestPowerMode();
+    return status;
+}
+
+/*!
+ * brief Checks if any enabled wake up source is responsible for last wake up
+ *       event. In such case, it will call the wake up source callback if it
+ *       has been registered. Likely to be called from Wake Up Unit IRQ Handler.
+ *
+ * return status_t The status of handling the wake up event.
+ */
+status_t PM_HandleWakeUpEvent(void)
+{
+    return PM_HandleWakeUpEventByHandle(s_pmHandle);
 }
 
 /*!
- * brief Enable/disable power manager functions.
+ * brief Same as PM_TriggerWakeSourceService(), on the power manager instance given by handle.
  *
- * param enable Used to enable/disable power manager functions.
+ * param handle Pointer to the pm_handle_t structure
  */
-void PM_EnablePowerManager(bool enable)
+status_t PM_TriggerWakeSourceServiceByHandle(pm_handle_t *handle, pm_wakeup_source_t *ws)
 {
-    /* Check whether Power Manager has been initialized or not */
-    assert(s_pmHandle != NULL);
-
-    if (s_pmHandle->enterCritical != NULL)
-    {
-        s_pmHandle->enterCritical();
-    }
+    assert(ws != NULL);
 
-    if (enable == true)
-    {
-        assert(s_pmHandle->disableCount > 0);
+    status_t status = kStatus_PMSuccess;
 
-        s_pmHandle->disableCount--;
+    PM_EnterCriticalRegion(handle);
 
-        if (s_pmHandle->disableCount == 0)
+    if (ws->enabled)
+    {
+        if (ws->active)
         {
-            s_pmHandle->enable = true;
+            status = kStatus_PMWakeupSourceServiceBusy;
         }
-    }
-    else
-    {
-        s_pmHandle->disableCount++;
-
-        if (s_pmHandle->disableCount >= 1)
+        else
         {
-            s_pmHandle->enable = false;
+            ws->active = true;
+            ws->service();
+            ws->active = false;
+
+            status = kStatus_PMSuccess;
         }
     }
-
-    if (s_pmHandle->exitCritical != NULL)
+    else
     {
-        s_pmHandle->exitCritical();
+        /*
+         * $Line Coverage Justification$
+         * $ref pm_core_c_ref_2$.
+         */
+        status = kStatus_PMWakeupSourceEnableError;
     }
+
+    PM_ExitCriticalRegion(handle);
+
+    return status;
 }
 
 /*!
- * brief Power manager core API, this API should be used on RTOS's IDLE task.
- *
- * This function contains several steps:
- * 1. Compute target power state based on the policy module.
- * 2. Notify upper layer software of the power mode entering.
- * 3. Enter into target power state.
- * 4. Exit from low power state, if wakeup event occurred.
- * 5. Notify upper layer software of the power mode exiting.
- *
- * The target power state is determined based on two factors:
- *   a. The input parameter should be larger than state's exitLatency attribution.
- *   b. resConstraintsMask logical AND state's lossFeature should equal to 0, because constraint can be understand as
- * some features can not loss.
+ * brief If the specfic wakeup event occurs, invoke this API to execute its service function.
  *
- * param duration The time in low power mode, this value is calculate from RTOS API.
+ * param ws Pointer to the wakeup source object.
+ * return status_t The status of trigger wakeup source behavior.
  */
-void PM_EnterLowPower(uint64_t duration)
+status_t PM_TriggerWakeSourceService(pm_wakeup_source_t *ws)
 {
-    uint8_t stateIndex;
-    status_t status = kStatus_PMSuccess;
-    pm_deepest_state_results_t results;
-
-    if (s_pmHandle->enable)
-    {
-        /* 1. Based on duration and system constraints compute the next allowed deepest power state. */
-        PM_findDeepestState(duration, &results);
-        stateIndex = results.deepestState;
-
-        if (stateIndex != 0xFFU)
-        {
-            s_pmHandle->targetState = stateIndex;
-
-#if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
-            /* Notify the enter of power state */
-            status = PM_notifyPowerStateEntry(stateIndex);
-#endif /* FSL_PM_SUPPORT_NOTIFICATION */
-
-            if (status == kStatus_PMSuccess)
-            {
-#if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
-                if (s_pmHandle->getTimestamp != NULL)
-                {
-                    s_pmHandle->entryTimestamp = s_pmHandle->getTimestamp();
-                }
+    return PM_TriggerWakeSourceServiceByHandle(s_pmHandle, ws);
+}
+#endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
 
-                /* Start low power timer if needed */
-                if (s_pmHandle->timerStart != NULL)
-                {
-                    s_pmHandle->timerStart(duration - (s_pmHandle->deviceOption->states[stateIndex].exitLatency));
-                }
-#endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
+/*!
+ * brief Same as PM_SetConstraints(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+status_t PM_SetConstraintsByHandle(pm_handle_t *handle, uint8_t powerModeConstraint, int32_t rescNum, ...)
+{
+    status_t ret;
+    va_list ap;
 
-                /* Enter into low power state. */
-                s_pmHandle->deviceOption->enter(stateIndex, &s_pmHandle->softConstraints, &s_pmHandle->sysRescGroup);
+    va_start(ap, rescNum);
+    ret = PM_SetConstraintList(handle, PM_CONSTRAINT_NO_OWNER, powerModeConstraint, rescNum, ap);
+    va_end(ap);
 
-#if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
-                /* Stop low power timer if it is started */
-                if (s_pmHandle->timerStop != NULL)
-                {
-                    s_pmHandle->timerStop();
-                }
+    return ret;
+}
 
-                if (s_pmHandle->getTimestamp != NULL)
-                {
-                    s_pmHandle->exitTimestamp = s_pmHandle->getTimestamp();
-                }
-#endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
-            }
+/*!
+ * brief Used to set constraints(including power mode constraint and resource constraints)
+ *
+ * For example, if the board support 3 resource constraints: PM_RESC_1, PM_RESC_2, PM_RESC3
+ *  code
+ *      PM_SetConstraints(Sleep_Mode, 3, PM_RESC_1, PM_RESC_2, PM_RESC_3);
+ *  endcode
+ *
+ * param powerModeConstraint The lowest power mode allowed, the power mode constraint macros
+ *                            can be found in fsl_pm_board.h
+ * param rescNum The number of resource constraints to be set.
+ * return status_t The status of set constraints behavior.
+ */
+status_t PM_SetConstraints(uint8_t powerModeConstraint, int32_t rescNum, ...)
+{
+    status_t ret;
+    va_list ap;
 
-#if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
-            /* Notify the exit of power state. */
-            (void)PM_notifyPowerStateExit(stateIndex);
-#endif /* FSL_PM_SUPPORT_NOTIFICATION */
+    va_start(ap, rescNum);
+    ret = PM_SetConstraintList(s_pmHandle, PM_CONSTRAINT_NO_OWNER, powerModeConstraint, rescNum, ap);
+    va_end(ap);
 
-            /*
-             * $Branch Coverage Justification$
-             * $ref pm_core_c_ref_1$.
-             */
-            if (s_pmHandle->deviceOption->clean != NULL)
-            {
-                s_pmHandle->deviceOption->clean();
-            }
-        }
-    }
+    return ret;
 }
 
-#if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
 /*!
- * brief Register timer controller related functions to power manager.
- *
- * If low power timer is the wakeup source, please remember to register it into power manager by using
- * PM_RegisterWakeupSource() function.
+ * brief Same as PM_ReleaseConstraints(), on the power manager instance given by handle.
  *
  * param handle Pointer to the pm_handle_t structure
- * param timerStart Low power timer start function, this parameter can be NULL, and it means low power timer is not set
- *  as the wakeup source.
- * param timerStop Low power timer stop function, this parameter can also be set as NULL.
- * param timerSync Low power timer sync function, this parameter can also be set as NULL.
- * param getTimestamp Low power timestamp function, this parameter can also be set as NULL.
- * param getTimerDuration Get timer count function. this parameter can also be set as NULL.
  */
-void PM_RegisterTimerController(pm_handle_t *handle,
-                                pm_low_power_timer_start_func_t timerStart,
-                                pm_low_power_timer_stop_func_t timerStop,
-                                pm_low_power_timer_get_timestamp_func_t getTimestamp,
-                                pm_low_power_timer_get_duration_func_t getTimerDuration)
+status_t PM_ReleaseConstraintsByHandle(pm_handle_t *handle, uint8_t powerModeConstraint, int32_t rescNum, ...)
 {
-    assert(handle != NULL);
-
-    if (s_pmHandle->enterCritical != NULL)
-    {
-        s_pmHandle->enterCritical();
-    }
+    status_t ret;
+    va_list ap;
 
-    handle->timerStart       = timerStart;
-    handle->timerStop        = timerStop;
-    handle->getTimerDuration = getTimerDuration;
-    handle->getTimestamp     = getTimestamp;
+    va_start(ap, rescNum);
+    ret = PM_ReleaseConstraintList(handle, PM_CONSTRAINT_NO_OWNER, powerModeConstraint, rescNum, ap);
+    va_end(ap);
 
-    if (s_pmHandle->exitCritical != NULL)
-    {
-        s_pmHandle->exitCritical();
-    }
+    return ret;
 }
 
-void PM_RegisterCriticalRegionController(pm_handle_t *handle,
-                                         pm_enter_critical criticalEntry,
-                                         pm_exit_critical criticalExit)
+/*!
+ * brief Used to release constraints(including power mode constraint and resource constraints)
+ *
+ * For example, if the board support 3 resource constraints: PM_RESC_1, PM_RESC_2, PM_RESC3
+ *  code
+ *      PM_ReleaseConstraints(Sleep_Mode, 1, PM_RESC_1);
+ *  endcode
+ *
+ * param powerModeConstraint The lowest power mode allowed, the power mode constraint macros
+ *                            can be found in fsl_pm_board.h
+ * param rescNum The number of resource constraints to be released.
+ * return status_t The status of set constraints behavior.
+ */
+status_t PM_ReleaseConstraints(uint8_t powerModeConstraint, int32_t rescNum, ...)
 {
-    assert(handle != NULL);
+    status_t ret;
+    va_list ap;
 
-    handle->enterCritical = criticalEntry;
-    handle->exitCritical  = criticalExit;
+    va_start(ap, rescNum);
+    ret = PM_ReleaseConstraintList(s_pmHandle, PM_CONSTRAINT_NO_OWNER, powerModeConstraint, rescNum, ap);
+    va_end(ap);
+
+    return ret;
 }
 
+#if (defined(FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING) && FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING)
 /*!
- * brief Get the actual low power state duration.
+ * brief Same as PM_SetOwnedConstraints(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
  */
-uint64_t PM_GetLastLowPowerDuration(void)
+status_t PM_SetOwnedConstraintsByHandle(pm_handle_t *handle,
+                                        pm_constraint_owner_t owner,
+                                        uint8_t powerModeConstraint,
+                                        int32_t rescNum,
+                                        ...)
 {
-    return s_pmHandle->getTimerDuration(s_pmHandle->entryTimestamp, s_pmHandle->exitTimestamp);
+    status_t ret;
+    va_list ap;
+
+    va_start(ap, rescNum);
+    ret = PM_SetConstraintList(handle, (uint32_t)owner, powerModeConstraint, rescNum, ap);
+    va_end(ap);
+
+    return ret;
 }
-#endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
 
-#if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
 /*!
- * brief Register notify element into the selected group.
+ * brief Same as PM_SetConstraints(), and records owner as a holder of each constraint set.
  *
- * param groupId The group of the notify list, this will affect the execution sequence.
- * param notifyElement The pointer to pm_notify_element_t.
- * return status_t The status of register notify object behavior.
+ * param owner Client id of the caller, chosen by the application.
+ * param powerModeConstraint The lowest power mode allowed, the power mode constraint macros
+ *                            can be found in fsl_pm_board.h
+ * param rescNum The number of resource constraints to be set.
+ * retval kStatus_PMConstraintOwnerTableFull No free record left for one of the constraints, none is set.
+ * return status_t The status of set constraints behavior.
  */
-status_t PM_RegisterNotify(pm_notify_group_t groupId, pm_notify_element_t *notifyElement)
+status_t PM_SetOwnedConstraints(pm_constraint_owner_t owner, uint8_t powerModeConstraint, int32_t rescNum, ...)
 {
-    assert(notifyElement != NULL);
-
-    status_t status = kStatus_PMSuccess;
+    status_t ret;
+    va_list ap;
 
-    if (LIST_AddTail((list_handle_t) & (s_pmHandle->notifyList[groupId]),
-                     (list_element_handle_t) & (notifyElement->link)) != kLIST_Ok)
-    {
-        status = kStatus_PMFail;
-    }
+    va_start(ap, rescNum);
+    ret = PM_SetConstraintList(s_pmHandle, (uint32_t)owner, powerModeConstraint, rescNum, ap);
+    va_end(ap);
 
-    return status;
+    return ret;
 }
 
 /*!
- * brief Update notify element's callback function and application data.
+ * brief Same as PM_ReleaseOwnedConstraints(), on the power manager instance given by handle.
  *
- * param notifyElement The pointer to the notify element to update.
- * param callback The callback function to be updated.
- * param data Pointer to the callback function private data.
+ * param handle Pointer to the pm_handle_t structure
  */
-void PM_UpdateNotify(void *notifyElement, pm_notify_callback_func_t callback, void *data)
+status_t PM_ReleaseOwnedConstraintsByHandle(pm_handle_t *handle,
+                                            pm_constraint_owner_t owner,
+                                            uint8_t powerModeConstraint,
+                                            int32_t rescNum,
+                                            ...)
 {
-    if (s_pmHandle->enterCritical != NULL)
-    {
-        s_pmHandle->enterCritical();
-    }
+    status_t ret;
+    va_list ap;
 
-    ((pm_notify_element_t *)notifyElement)->data           = data;
-    ((pm_notify_element_t *)notifyElement)->notifyCallback = callback;
+    va_start(ap, rescNum);
+    ret = PM_ReleaseConstraintList(handle, (uint32_t)owner, powerModeConstraint, rescNum, ap);
+    va_end(ap);
 
-    if (s_pmHandle->exitCritical != NULL)
-    {
-        s_pmHandle->exitCritical();
-    }
+    return ret;
 }
 
 /*!
- * brief Remove notify element from its notify group.
+ * brief Same as PM_ReleaseConstraints(), for constraints set with PM_SetOwnedConstraints().
  *
- * param notifyElement The pointer to the notify element to remove.
+ * param owner Client id that set the constraints.
+ * param powerModeConstraint The power mode constraint to release.
+ * param rescNum The number of resource constraints to be released.
+ * retval kStatus_PMConstraintNotOwned The owner does not hold one of the constraints, that constraint is left set.
+ * return status_t The status of release constraints behavior.
  */
-status_t PM_UnregisterNotify(void *notifyElement)
+status_t PM_ReleaseOwnedConstraints(pm_constraint_owner_t owner, uint8_t powerModeConstraint, int32_t rescNum, ...)
 {
-    status_t status = kStatus_PMSuccess;
+    status_t ret;
+    va_list ap;
 
-    if (s_pmHandle->enterCritical != NULL)
-    {
-        s_pmHandle->enterCritical();
-    }
+    va_start(ap, rescNum);
+    ret = PM_ReleaseConstraintList(s_pmHandle, (uint32_t)owner, powerModeConstraint, rescNum, ap);
+    va_end(ap);
 
-    if (LIST_RemoveElement((list_element_handle_t) & (((pm_notify_element_t *)notifyElement)->link)) != kLIST_Ok)
-    {
-        status = kStatus_PMFail;
-    }
+    return ret;
+}
 
-    if (s_pmHandle->exitCritical != NULL)
-    {
-        s_pmHandle->exitCritical();
-    }
+/*!
+ * brief Same as PM_GetConstraintOwners(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+uint8_t PM_GetConstraintOwnersByHandle(pm_handle_t *handle,
+                                       uint32_t rescIndex,
+                                       pm_constraint_owner_t *owners,
+                                       uint8_t maxOwners)
+{
+    assert(rescIndex < (uint32_t)PM_CONSTRAINT_COUNT);
 
-    return status;
+    return PM_CollectConstraintOwners(handle, rescIndex, PM_CONSTRAINT_RESC_INDEX_MASK, owners, maxOwners);
 }
-#endif /* FSL_PM_SUPPORT_NOTIFICATION */
 
-#if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
 /*!
- * brief Initialize the wakeup source object.
+ * brief Get the owners currently holding a resource constraint.
  *
- * param ws    Pointer to the pm_wakeup_source_t variable.
- * param wsId  Used to select the wakeup source, the wsId of each wakeup source can be found in fsl_pm_board.h
- * param service The function to be invoked when wake up source asserted.
- * param enable Used to enable/disable the selected wakeup source.
+ * param rescIndex Index of the resource, see resc_name_t in fsl_pm_board.h.
+ * param owners Output array of owner ids, can be NULL if maxOwners is 0.
+ * param maxOwners Size of the owners array.
+ * return Number of owners holding the constraint, may be larger than maxOwners.
  */
-void PM_InitWakeupSource(pm_wakeup_source_t *ws, uint32_t wsId, pm_wake_up_source_service_func_t service, bool enable)
+uint8_t PM_GetConstraintOwners(uint32_t rescIndex, pm_constraint_owner_t *owners, uint8_t maxOwners)
 {
-    assert(ws != NULL);
+    return PM_GetConstraintOwnersByHandle(s_pmHandle, rescIndex, owners, maxOwners);
+}
 
-    if (s_pmHandle->enterCritical != NULL)
-    {
-        s_pmHandle->enterCritical();
-    }
+/*!
+ * brief Same as PM_GetPowerModeConstraintOwners(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+uint8_t PM_GetPowerModeConstraintOwnersByHandle(pm_handle_t *handle,
+                                                uint8_t powerMode,
+                                                pm_constraint_owner_t *owners,
+                                                uint8_t maxOwners)
+{
+    assert(powerMode < PM_LP_STATE_COUNT);
 
-    ws->wsId    = wsId;
-    ws->service = service;
-    ws->enabled = enable;
-    ws->active  = false;
+    return PM_CollectConstraintOwners(handle, PM_MODE_CONSTRAINT(powerMode), 0xFFFFFFFFUL, owners, maxOwners);
+}
 
-    if (enable == true)
-    {
-        (void)LIST_AddTail((list_handle_t) & (s_pmHandle->wakeupSourceList), (list_element_handle_t) & (ws->link));
-    }
+/*!
+ * brief Get the owners currently holding a power mode constraint.
+ *
+ * param powerMode Power mode index, the macros can be found in fsl_pm_board.h.
+ * param owners Output array of owner ids, can be NULL if maxOwners is 0.
+ * param maxOwners Size of the owners array.
+ * return Number of owners holding the constraint, may be larger than maxOwners.
+ */
+uint8_t PM_GetPowerModeConstraintOwners(uint8_t powerMode, pm_constraint_owner_t *owners, uint8_t maxOwners)
+{
+    return PM_GetPowerModeConstraintOwnersByHandle(s_pmHandle, powerMode, owners, maxOwners);
+}
+#endif /* FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING */
 
-    (void)(s_pmHandle->deviceOption->manageWakeupSource(ws, enable));
+#if (defined(FSL_PM_SUPPORT_TIMED_CONSTRAINTS) && FSL_PM_SUPPORT_TIMED_CONSTRAINTS)
+/*!
+ * brief Initialize a timed resource constraint object.
+ *
+ * param timedConstraint Pointer to the timed constraint object.
+ * param rescConstraint Resource constraint to hold, as encoded by PM_ENCODE_RESC().
+ * param delay Grace period before the constraint is really released, in us, the unit of the exit latencies and of
+ *              the getTimerDuration function. 0 releases the constraint immediately.
+ */
+void PM_InitTimedConstraint(pm_timed_constraint_t *timedConstraint, int32_t rescConstraint, uint64_t delay)
+{
+    assert(timedConstraint != NULL);
 
-    if (s_pmHandle->exitCritical != NULL)
-    {
-        s_pmHandle->exitCritical();
-    }
+    (void)memset(timedConstraint, 0, sizeof(*timedConstraint));
+    timedConstraint->rescConstraint = rescConstraint;
+    timedConstraint->delay          = delay;
 }
 
 /*!
- * brief Enable wakeup source.
+ * brief Same as PM_AcquireTimedConstraint(), on the power manager instance given by handle.
  *
- * param ws Pointer to the wakeup source object to be enabled.
- * return status_t The status of enable wakeup source behavior.
+ * param handle Pointer to the pm_handle_t structure
  */
-status_t PM_EnableWakeupSource(pm_wakeup_source_t *ws)
+status_t PM_AcquireTimedConstraintByHandle(pm_handle_t *handle, pm_timed_constraint_t *timedConstraint)
 {
-    assert(ws != NULL);
+    assert(timedConstraint != NULL);
 
     status_t status = kStatus_PMSuccess;
 
-    if (s_pmHandle->enterCritical != NULL)
+    PM_EnterCriticalRegion(handle);
+
+    if (timedConstraint->pending)
     {
-        s_pmHandle->enterCritical();
+        /* Still held, just cancel the release */
+        (void)LIST_RemoveElement((list_element_handle_t) & (timedConstraint->link));
+        timedConstraint->pending = false;
     }
-
-    if (!(ws->enabled))
+    else if (!(timedConstraint->held))
     {
-        /* Add wake up source to list so PM can parse the list if wake up event
-         * occurs, and trigger the service callback if needed */
-        (void)LIST_AddTail((list_handle_t) & (s_pmHandle->wakeupSourceList), (list_element_handle_t) & (ws->link));
-        status = s_pmHandle->deviceOption->manageWakeupSource(ws, true);
-
-        if (status == kStatus_Success)
-        {
-            ws->enabled = true;
-        }
-        else
+        status = PM_SetOneConstraint(handle, PM_CONSTRAINT_NO_OWNER, (uint32_t)timedConstraint->rescConstraint);
+        if (status == kStatus_PMSuccess)
         {
-            /*
-             * $Line Coverage Justification$
-             * $ref pm_core_c_ref_2$.
-             */
-            status = kStatus_PMWakeupSourceEnableError;
+            timedConstraint->held = true;
         }
     }
-
-    if (s_pmHandle->exitCritical != NULL)
+    else
     {
-        s_pmHandle->exitCritical();
+        /* Already held */
     }
 
+    PM_ExitCriticalRegion(handle);
+
     return status;
 }
 
 /*!
- * brief Disable wakeup source
+ * brief Set the resource constraint of a timed constraint object.
  *
- * param ws Pointer to the wakeup source object to be disabled.
- * return status_t The status of disable wakeup source behavior.
+ * If a release is pending, it is cancelled and the resource is kept without any new set request.
+ *
+ * param timedConstraint Pointer to the timed constraint object.
+ * return status_t The status of set constraints behavior.
  */
-status_t PM_DisableWakeupSource(pm_wakeup_source_t *ws)
+status_t PM_AcquireTimedConstraint(pm_timed_constraint_t *timedConstraint)
 {
-    assert(ws != NULL);
+    return PM_AcquireTimedConstraintByHandle(s_pmHandle, timedConstraint);
+}
+
+/*!
+ * brief Same as PM_ReleaseTimedConstraint(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+status_t PM_ReleaseTimedConstraintByHandle(pm_handle_t *handle, pm_timed_constraint_t *timedConstraint)
+{
+    assert(timedConstraint != NULL);
 
     status_t status = kStatus_PMSuccess;
 
-    if (s_pmHandle->enterCritical != NULL)
-    {
-        s_pmHandle->enterCritical();
-    }
+    PM_EnterCriticalRegion(handle);
 
-    if (ws->enabled)
+    if ((timedConstraint->held) && !(timedConstraint->pending))
     {
-        /* Remove the wake up source from the list */
-        (void)LIST_RemoveElement((list_element_handle_t) & (ws->link));
-        status = s_pmHandle->deviceOption->manageWakeupSource(ws, false);
-
-        if (status == kStatus_Success)
+        if ((timedConstraint->delay == 0U) || (handle->getTimestamp == NULL) ||
+            (handle->getTimerDuration == NULL))
         {
-            ws->enabled = false;
+            PM_ReleaseTimedConstraintNow(handle, timedConstraint);
         }
         else
         {
-            /*
-             * $Line Coverage Justification$
-             * $ref pm_core_c_ref_2$.
-             */
-            status = kStatus_PMWakeupSourceDisableError;
+            timedConstraint->releaseTimestamp = handle->getTimestamp();
+            if (LIST_AddTail((list_handle_t) & (handle->timedConstraintList),
+                             (list_element_handle_t) & (timedConstraint->link)) == kLIST_Ok)
+            {
+                timedConstraint->pending = true;
+            }
+            else
+            {
+                /*
+                 * $Line Coverage Justification$
+                 * $ref pm_core_c_ref_2$.
+                 */
+                status = kStatus_PMFail;
+            }
         }
     }
 
-    if (s_pmHandle->exitCritical != NULL)
-    {
-        s_pmHandle->exitCritical();
-    }
+    PM_ExitCriticalRegion(handle);
 
     return status;
 }
 
 /*!
- * brief Checks if any enabled wake up source is responsible for last wake up
- *       event. In such case, it will call the wake up source callback if it
- *       has been registered. Likely to be called from Wake Up Unit IRQ Handler.
+ * brief Release the resource constraint of a timed constraint object after its delay.
  *
- * return status_t The status of handling the wake up event.
+ * param timedConstraint Pointer to the timed constraint object.
+ * return status_t The status of release constraints behavior.
  */
-status_t PM_HandleWakeUpEvent(void)
+status_t PM_ReleaseTimedConstraint(pm_timed_constraint_t *timedConstraint)
 {
-    status_t status = kStatus_PMSuccess;
-    pm_wakeup_source_t *currWakeUpSource;
+    return PM_ReleaseTimedConstraintByHandle(s_pmHandle, timedConstraint);
+}
+#endif /* FSL_PM_SUPPORT_TIMED_CONSTRAINTS */
 
-    if (LIST_GetSize((list_handle_t) & (s_pmHandle->wakeupSourceList)) != 0UL)
-    {
-        currWakeUpSource = (pm_wakeup_source_t *)(void *)(s_pmHandle->wakeupSourceList.head);
+#if (defined(FSL_PM_SUPPORT_LATENCY_QOS) && FSL_PM_SUPPORT_LATENCY_QOS)
+/*!
+ * brief Same as PM_AddLatencyRequest(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+status_t PM_AddLatencyRequestByHandle(pm_handle_t *handle, pm_latency_request_t *request, uint32_t maxLatency)
+{
+    assert(request != NULL);
 
-        /* the list should contain only enabled ws */
-        assert(currWakeUpSource->enabled == true);
+    status_t status;
 
-        do
-        {
-            if (currWakeUpSource->service != NULL)
-            {
-                if (s_pmHandle->deviceOption->isWakeupSource(currWakeUpSource) == true)
-                {
-                    /* The wake up source trigger the last wake up event
-                     * we can call the callback */
-                    status = PM_TriggerWakeSourceService(currWakeUpSource);
-                }
-            }
+    PM_EnterCriticalRegion(handle);
 
-            currWakeUpSource = (pm_wakeup_source_t *)(void *)currWakeUpSource->link.next;
-        } while (currWakeUpSource != NULL);
-    }
+    request->maxLatency = maxLatency;
+    status              = PM_InsertLatencyRequest(handle, request);
+
+    PM_ExitCriticalRegion(handle);
 
     return status;
 }
 
 /*!
- * brief If the specfic wakeup event occurs, invoke this API to execute its service function.
+ * brief Register a maximum wakeup latency request.
  *
- * param ws Pointer to the wakeup source object.
- * return status_t The status of trigger wakeup source behavior.
+ * While the request is active, power states whose exit latency exceeds maxLatency are not selected by the policy.
+ *
+ * param request Pointer to the request object, it must stay allocated until the request is removed.
+ * param maxLatency Maximum wakeup latency tolerated by the client, in us.
+ * return status_t The status of add latency request behavior.
  */
-status_t PM_TriggerWakeSourceService(pm_wakeup_source_t *ws)
+status_t PM_AddLatencyRequest(pm_latency_request_t *request, uint32_t maxLatency)
 {
-    assert(ws != NULL);
+    return PM_AddLatencyRequestByHandle(s_pmHandle, request, maxLatency);
+}
+
+/*!
+ * brief Same as PM_UpdateLatencyRequest(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+status_t PM_UpdateLatencyRequestByHandle(pm_handle_t *handle, pm_latency_request_t *request, uint32_t maxLatency)
+{
+    assert(request != NULL);
 
     status_t status = kStatus_PMSuccess;
 
-    if (s_pmHandle->enterCritical != NULL)
-    {
-        s_pmHandle->enterCritical();
-    }
+    PM_EnterCriticalRegion(handle);
 
-    if (ws->enabled)
+    if (LIST_RemoveElement((list_element_handle_t) & (request->link)) != kLIST_Ok)
     {
-        if (ws->active)
-        {
-            status = kStatus_PMWakeupSourceServiceBusy;
-        }
-        else
-        {
-            ws->active = true;
-            ws->service();
-            ws->active = false;
-
-            status = kStatus_PMSuccess;
-        }
+        status = kStatus_PMFail;
     }
     else
     {
-        /*
-         * $Line Coverage Justification$
-         * $ref pm_core_c_ref_2$.
-         */
-        status = kStatus_PMWakeupSourceEnableError;
+        request->maxLatency = maxLatency;
+        status              = PM_InsertLatencyRequest(handle, request);
     }
 
-    if (s_pmHandle->exitCritical != NULL)
-    {
-        s_pmHandle->exitCritical();
-    }
+    PM_ExitCriticalRegion(handle);
 
     return status;
 }
-#endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
 
 /*!
- * brief Used to set constraints(including power mode constraint and resource constraints)
+ * brief Update the maximum wakeup latency of an active request.
  *
- * For example, if the board support 3 resource constraints: PM_RESC_1, PM_RESC_2, PM_RESC3
- *  code
- *      PM_SetConstraints(Sleep_Mode, 3, PM_RESC_1, PM_RESC_2, PM_RESC_3);
- *  endcode
+ * param request Pointer to the request object previously added with PM_AddLatencyRequest().
+ * param maxLatency New maximum wakeup latency, in us.
+ * return status_t The status of update latency request behavior.
+ */
+status_t PM_UpdateLatencyRequest(pm_latency_request_t *request, uint32_t maxLatency)
+{
+    return PM_UpdateLatencyRequestByHandle(s_pmHandle, request, maxLatency);
+}
+
+/*!
+ * brief Same as PM_RemoveLatencyRequest(), on the power manager instance given by handle.
  *
- * param powerModeConstraint The lowest power mode allowed, the power mode constraint macros
- *                            can be found in fsl_pm_board.h
- * param rescNum The number of resource constraints to be set.
- * return status_t The status of set constraints behavior.
+ * param handle Pointer to the pm_handle_t structure
  */
-status_t PM_SetConstraints(uint8_t powerModeConstraint, int32_t rescNum, ...)
+status_t PM_RemoveLatencyRequestByHandle(pm_handle_t *handle, pm_latency_request_t *request)
 {
-    status_t ret = kStatus_Success;
-    uint32_t opMode;
-    uint32_t rescShift;
-    int32_t inputResc;
-    va_list ap;
-    int32_t i;
-    uint32_t curRescOpMode;
-    uint32_t opModeToSet;
+    assert(request != NULL);
 
-    if (s_pmHandle->enterCritical != NULL)
-    {
-        s_pmHandle->enterCritical();
-    }
+    status_t status = kStatus_PMSuccess;
 
-    if (powerModeConstraint != PM_LP_STATE_NO_CONSTRAINT)
-    {
-        if (powerModeConstraint >= PM_LP_STATE_COUNT)
-        {
-            /* wrong power mode index passed in parameter */
-            ret = kStatus_Fail;
-        }
-        else
-        {
-            /* Set power mode constraint */
-            s_pmHandle->powerModeConstraintCount[powerModeConstraint]++;
-            PM_SetAllowedLowestPowerMode();
-        }
-    }
-    else
-    {
-        /* No power mode constraint to apply, only ressource constraints */
-        ;
-    }
+    PM_EnterCriticalRegion(handle);
 
-    if (rescNum != 0)
+    if (LIST_RemoveElement((list_element_handle_t) & (request->link)) != kLIST_Ok)
     {
-        va_start(ap, rescNum);
-
-        for (i = 0; i < rescNum; i++)
-        {
-            inputResc = (int32_t)va_arg(ap, int32_t);
-            PM_DECODE_RESC(inputResc);
-
-            assert(rescShift < (uint32_t)PM_CONSTRAINT_COUNT);
-            curRescOpMode = s_pmHandle->sysRescGroup.groupSlice[rescShift / 8UL];
-            opModeToSet   = ((uint32_t)opMode << (4UL * ((uint32_t)rescShift % 8UL)));
-            if ((curRescOpMode & opModeToSet) == 0UL)
-            {
-                s_pmHandle->sysRescGroup.groupSlice[rescShift / 8UL] |=
-                    ((uint32_t)opMode << (4UL * ((uint32_t)rescShift % 8UL)));
-                s_pmHandle->resConstraintCount[rescShift]++;
-                s_pmHandle->resConstraintMask.rescMask[rescShift / 32UL] |= (1UL << ((uint32_t)rescShift % 32UL));
-            }
-        }
-        va_end(ap);
+        status = kStatus_PMFail;
     }
 
-    if (s_pmHandle->exitCritical != NULL)
-    {
-        s_pmHandle->exitCritical();
-    }
+    PM_ExitCriticalRegion(handle);
 
-    return ret;
+    return status;
 }
 
 /*!
- * brief Used to release constraints(including power mode constraint and resource constraints)
- *
- * For example, if the board support 3 resource constraints: PM_RESC_1, PM_RESC_2, PM_RESC3
- *  code
- *      PM_ReleaseConstraints(Sleep_Mode, 1, PM_RESC_1);
- *  endcode
+ * brief Remove a latency request.
  *
- * param powerModeConstraint The lowest power mode allowed, the power mode constraint macros
- *                            can be found in fsl_pm_board.h
- * param rescNum The number of resource constraints to be released.
- * return status_t The status of set constraints behavior.
+ * param request Pointer to the request object to remove.
+ * return status_t The status of remove latency request behavior.
  */
-status_t PM_ReleaseConstraints(uint8_t powerModeConstraint, int32_t rescNum, ...)
+status_t PM_RemoveLatencyRequest(pm_latency_request_t *request)
 {
-    status_t ret = kStatus_Success;
-    uint32_t opMode;
-    uint32_t rescShift;
-    int32_t inputResc;
-    va_list ap;
-    int32_t i;
-    uint32_t curRescOpMode;
-    uint32_t opModeToRelease;
+    return PM_RemoveLatencyRequestByHandle(s_pmHandle, request);
+}
 
-    if (s_pmHandle->enterCritical != NULL)
-    {
-        s_pmHandle->enterCritical();
-    }
+/*!
+ * brief Same as PM_GetLatencyConstraint(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+uint32_t PM_GetLatencyConstraintByHandle(pm_handle_t *handle)
+{
+    uint32_t maxLatency = PM_LATENCY_NO_CONSTRAINT;
+    pm_latency_request_t *headRequest = (pm_latency_request_t *)(void *)(handle->latencyRequestList.head);
 
-    if (powerModeConstraint != PM_LP_STATE_NO_CONSTRAINT)
-    {
-        if (powerModeConstraint >= PM_LP_STATE_COUNT)
-        {
-            /* wrong power mode index passed in parameter */
-            ret = kStatus_Fail;
-        }
-        else
-        {
-            /* Release power mode constraint */
-            if (s_pmHandle->powerModeConstraintCount[powerModeConstraint] > 0U)
-            {
-                s_pmHandle->powerModeConstraintCount[powerModeConstraint]--;
-            }
-            PM_SetAllowedLowestPowerMode();
-        }
-    }
-    else
+    /* The list is sorted, the head holds the most demanding request */
+    if (headRequest != NULL)
     {
-        /* No power mode constraint to release, only ressource constraints */
-        ;
+        maxLatency = headRequest->maxLatency;
     }
 
-    if (rescNum != 0)
-    {
-        va_start(ap, rescNum);
-
-        for (i = 0; i < rescNum; i++)
-        {
-            inputResc = (int32_t)va_arg(ap, int32_t);
-            PM_DECODE_RESC(inputResc);
-
-            curRescOpMode   = s_pmHandle->sysRescGroup.groupSlice[rescShift / 8UL];
-            opModeToRelease = ((uint32_t)opMode << (4UL * ((uint32_t)rescShift % 8UL)));
-            if ((curRescOpMode & opModeToRelease) != 0UL)
-            {
-                s_pmHandle->sysRescGroup.groupSlice[rescShift / 8UL] &=
-                    ~((uint32_t)opMode << (4UL * ((uint32_t)rescShift % 8UL)));
-                if (s_pmHandle->resConstraintCount[rescShift] == 1UL)
-                {
-                    s_pmHandle->resConstraintMask.rescMask[rescShift / 32UL] &= ~(1UL << ((uint32_t)rescShift % 32UL));
-                }
-                s_pmHandle->resConstraintCount[rescShift]--;
-            }
-        }
-        va_end(ap);
-    }
+    return maxLatency;
+}
 
-    if (s_pmHandle->exitCritical != NULL)
-    {
-        s_pmHandle->exitCritical();
-    }
+/*!
+ * brief Get the smallest maximum wakeup latency over the active requests.
+ *
+ * return The latency in us, or PM_LATENCY_NO_CONSTRAINT if no request is active.
+ */
+uint32_t PM_GetLatencyConstraint(void)
+{
+    return PM_GetLatencyConstraintByHandle(s_pmHandle);
+}
+#endif /* FSL_PM_SUPPORT_LATENCY_QOS */
 
-    return ret;
+/*!
+ * brief Same as PM_GetResourceConstraintsMask(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+pm_resc_mask_t PM_GetResourceConstraintsMaskByHandle(pm_handle_t *handle)
+{
+    return handle->resConstraintMask;
 }
 
 /*!
@@ -961,7 +3361,17 @@ status_t PM_ReleaseConstraints(uint8_t powerModeConstraint, int32_t rescNum, ...
  */
 pm_resc_mask_t PM_GetResourceConstraintsMask(void)
 {
-    return s_pmHandle->resConstraintMask;
+    return PM_GetResourceConstraintsMaskByHandle(s_pmHandle);
+}
+
+/*!
+ * brief Same as PM_GetAllowedLowestPowerMode(), on the power manager instance given by handle.
+ *
+ * param handle Pointer to the pm_handle_t structure
+ */
+uint8_t PM_GetAllowedLowestPowerModeByHandle(pm_handle_t *handle)
+{
+    return handle->powerModeConstraint;
 }
 
 /*!
@@ -971,5 +3381,5 @@ pm_resc_mask_t PM_GetResourceConstraintsMask(void)
  */
 uint8_t PM_GetAllowedLowestPowerMode(void)
 {
-    return s_pmHandle->powerModeConstraint;
+    return PM_GetAllowedLowestPowerModeByHandle(s_pmHandle);
 }
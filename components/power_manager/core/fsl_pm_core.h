@@ -116,6 +116,20 @@
 /*! @} */
 #endif /* FSL_PM_SUPPORT_ALWAYS_ON_SECTION */
 
+#if (defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+/*! @name Static Tables */
+#if (defined(__ICCARM__) || defined(__CC_ARM) || defined(__ARMCC_VERSION))
+#error FSL_PM_SUPPORT_STATIC_TABLES is only supported with GCC.
+#elif (defined(__GNUC__))
+/* The alignment is given explicitly so that the compiler does not pad the table entries. */
+#define AT_PM_STATIC_TABLE(sectionName, type, name) \
+    __attribute__((section(sectionName), used, aligned(__alignof__(type)))) type name
+#else
+#error Toolchain not supported.
+#endif /* defined(__ICCARM__) */
+/*! @} */
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+
 /*!
  * @brief Power manager status.
  * @anchor _pm_status
@@ -129,8 +143,46 @@ enum
     kStatus_PMWakeupSourceServiceBusy  = MAKE_STATUS(kStatusGroup_POWER_MANAGER, 3U),
     kStatus_PMPowerStateNotAllowed     = MAKE_STATUS(kStatusGroup_POWER_MANAGER, 4U),
     kStatus_PMNotifyEventError         = MAKE_STATUS(kStatusGroup_POWER_MANAGER, 5U),
+    kStatus_PMConstraintCountOverflow  = MAKE_STATUS(kStatusGroup_POWER_MANAGER, 6U),
+    kStatus_PMConstraintOwnerTableFull = MAKE_STATUS(kStatusGroup_POWER_MANAGER, 7U),
+    kStatus_PMConstraintNotOwned       = MAKE_STATUS(kStatusGroup_POWER_MANAGER, 8U),
+    kStatus_PMEventQueueFull           = MAKE_STATUS(kStatusGroup_POWER_MANAGER, 9U),
 };
 
+/*!
+ * @brief Type of the constraint reference counters, selected by FSL_PM_CONSTRAINT_COUNTER_WIDTH.
+ */
+#if (FSL_PM_CONSTRAINT_COUNTER_WIDTH == 32U)
+typedef uint32_t pm_constraint_count_t;
+#define PM_CONSTRAINT_COUNT_MAX (0xFFFFFFFFUL)
+#elif (FSL_PM_CONSTRAINT_COUNTER_WIDTH == 16U)
+typedef uint16_t pm_constraint_count_t;
+#define PM_CONSTRAINT_COUNT_MAX (0xFFFFU)
+#elif (FSL_PM_CONSTRAINT_COUNTER_WIDTH == 8U)
+typedef uint8_t pm_constraint_count_t;
+#define PM_CONSTRAINT_COUNT_MAX (0xFFU)
+#else
+#error FSL_PM_CONSTRAINT_COUNTER_WIDTH must be 8, 16 or 32.
+#endif /* FSL_PM_CONSTRAINT_COUNTER_WIDTH */
+
+#if (defined(FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING) && FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING)
+/*!
+ * @brief Client id used to record the holder of a constraint.
+ */
+typedef uint8_t pm_constraint_owner_t;
+
+/*!
+ * @brief One entry of the constraint owner table, a slot is free when its count is 0.
+ */
+typedef struct _pm_constraint_owner_record
+{
+    pm_constraint_owner_t owner; /*!< Client id that set the constraint. */
+    uint16_t constraint;         /*!< Resource constraint as encoded by PM_ENCODE_RESC(), or power mode index with
+                                      bit 15 set. */
+    pm_constraint_count_t count; /*!< Number of outstanding set requests from this owner. */
+} pm_constraint_owner_record_t;
+#endif /* FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING */
+
 /*!
  * @brief Reason types for results of PM_findDeepestState()
  */
@@ -140,6 +192,8 @@ typedef enum _pm_deepest_state_reasons
     kPM_reason_latency,             /*!< the duration ruled out deeper states */
     kPM_reason_mode_constraint,     /*!< power-mode constraint determined this state */
     kPM_reason_resc,                /*!< a resource constraint determined this state */
+    kPM_reason_latency_qos,         /*!< a latency QoS request ruled out deeper states */
+    kPM_reason_governor,            /*!< the governor preferred this state over deeper allowed states */
 } pm_deepest_state_reasons_t;
 
 /*!
@@ -184,16 +238,93 @@ typedef enum _pm_notify_group
  */
 typedef status_t (*pm_notify_callback_func_t)(pm_event_type_t eventType, uint8_t powerState, void *data);
 
+#if (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+/*!
+ * @brief Notify state mask bit of a power state, to be set in the stateMask member of @ref pm_notify_element_t.
+ */
+#define PM_NOTIFY_STATE(state) (1UL << (uint32_t)(state))
+
+/*!
+ * @brief Notify state mask of all the power states.
+ */
+#define PM_NOTIFY_ALL_STATES ((1UL << PM_LP_STATE_COUNT) - 1UL)
+
+/*!
+ * @brief Notify state mask of a power state and all the deeper ones.
+ */
+#define PM_NOTIFY_STATES_FROM(state) (PM_NOTIFY_ALL_STATES & ~(PM_NOTIFY_STATE(state) - 1UL))
+#endif /* FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK)
+/*!
+ * @brief Status returned by an entry notifier that does not tolerate the notified power state, but tolerates the
+ * power state @p state and the shallower ones. The power manager then falls back to the deepest allowed of these
+ * states, and only the notifiers not yet called are notified of it: the following ones, and with the state masks the
+ * previous ones skipped for the deeper state. The notifier itself is called again if its state mask has the new state.
+ */
+#define PM_NOTIFY_FALLBACK(state) ((status_t)MAKE_STATUS(kStatusGroup_POWER_MANAGER, 32U + (uint32_t)(state)))
+#endif /* FSL_PM_SUPPORT_NOTIFY_FALLBACK */
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+/*!
+ * @brief Execution time statistics of a notifier callback, in CPU cycles.
+ */
+typedef struct _pm_notify_timing
+{
+    uint32_t minCycles;   /*!< Shortest execution. */
+    uint32_t maxCycles;   /*!< Longest execution. */
+    uint64_t totalCycles; /*!< Sum of the executions, see PM_GetNotifyAverageCycles(). */
+    uint32_t count;       /*!< Number of executions. */
+} pm_notify_timing_t;
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+
 /*!
  * @brief Power manager notify object structure.
  */
 typedef struct _pm_notify_element
 {
+#if !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
     list_element_t link;                      /*!< For placing on the notify list. */
+#endif                                        /* FSL_PM_SUPPORT_STATIC_TABLES */
     pm_notify_callback_func_t notifyCallback; /*!< Registered notification callback function.  */
     void *data;                               /*!< Pointer to a custom argument. */
+#if (defined(FSL_PM_SUPPORT_NOTIFY_PRIORITY) && FSL_PM_SUPPORT_NOTIFY_PRIORITY)
+    uint8_t priority; /*!< Position in the group, the lower values are notified first. The notifiers with the same
+                           priority keep the registration order. */
+#endif                /* FSL_PM_SUPPORT_NOTIFY_PRIORITY */
+#if (defined(FSL_PM_SUPPORT_NOTIFY_STATE_MASK) && FSL_PM_SUPPORT_NOTIFY_STATE_MASK)
+    uint32_t stateMask; /*!< Power states the notifier is called for, see PM_NOTIFY_STATE(). If 0 when calling
+                             PM_RegisterNotify(), it is set to PM_NOTIFY_ALL_STATES. */
+#endif                  /* FSL_PM_SUPPORT_NOTIFY_STATE_MASK */
+#if (defined(FSL_PM_SUPPORT_NOTIFY_FALLBACK) && FSL_PM_SUPPORT_NOTIFY_FALLBACK)
+    uint8_t notifiedState; /*!< Power state given to the entry callback, and then to the exit callback. */
+#endif                     /* FSL_PM_SUPPORT_NOTIFY_FALLBACK */
+#if (defined(FSL_PM_SUPPORT_DEFERRED_NOTIFY) && FSL_PM_SUPPORT_DEFERRED_NOTIFY)
+    bool deferExit;   /*!< Set to true before PM_RegisterNotify() to run the exit callback out of the wakeup path. */
+    bool exitPending; /*!< The exit callback is waiting for PM_RunDeferredNotify(). */
+#endif                /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+    uint32_t exitLatencyBudget;   /*!< Time the exit callback is allowed to take, in us. It is added to the exit
+                                       latency of the power states the notifier is called for, and must be set
+                                       before PM_RegisterNotify(). */
+    uint32_t budgetOverrunCount;  /*!< Number of exit callbacks that took longer than exitLatencyBudget. */
+    pm_notify_timing_t entryTiming; /*!< Execution time of the entry callback. */
+    pm_notify_timing_t exitTiming;  /*!< Execution time of the exit callback. */
+#endif                              /* FSL_PM_SUPPORT_NOTIFY_TIMING */
 } pm_notify_element_t;
 
+#if (defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+/*!
+ * @brief Define a notify element in the static notify table of a group.
+ *
+ * The notifiers of a group are sorted by increasing priority by the linker. The group (0 to 2) and the priority must
+ * be integer literals, the remaining arguments initialize the notify element, for example
+ * PM_NOTIFY_DEFINE(g_uartNotify, 1, 20, .notifyCallback = UART_PowerNotify, .data = NULL);
+ */
+#define PM_NOTIFY_DEFINE(name, group, priority, ...) \
+    AT_PM_STATIC_TABLE(".pm_notify_group" #group "." #priority, pm_notify_element_t, name) = {__VA_ARGS__}
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+
 #endif /* FSL_PM_SUPPORT_NOTIFICATION */
 
 #if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
@@ -210,7 +341,9 @@ typedef void (*pm_wake_up_source_service_func_t)(void);
  */
 typedef struct _pm_wakeup_source
 {
+#if !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
     list_element_t link; /*!< For placing on the wake up source list. */
+#endif                   /* FSL_PM_SUPPORT_STATIC_TABLES */
     uint32_t wsId; /*!< The wakeup source id that the MCU supports, this value is used to config wakeup source manager
                       hardware peripheral. NXP will provided wakeup source id for each specific MCU. */
     pm_wake_up_source_service_func_t service; /*! Wakeup source service function that should be executed if the
@@ -218,8 +351,52 @@ typedef struct _pm_wakeup_source
     bool enabled : 1U;                        /*!< Enable/disable wakeup source. */
     bool active : 1U;                         /*!< Indicate whether the corresponding wakeup event occurs. */
 } pm_wakeup_source_t;
+
+#if (defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+/*!
+ * @brief Define a wakeup source in the static wakeup source table. It is disabled until PM_InitWakeupSource() or
+ * PM_EnableWakeupSource() is called.
+ */
+#define PM_WAKEUP_SOURCE_DEFINE(name, id, func)                                 \
+    AT_PM_STATIC_TABLE(".pm_wakeup_source_table", pm_wakeup_source_t, name) = { \
+        .wsId = (id), .service = (func), .enabled = false, .active = false}
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
 #endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
 
+/*!
+ * @brief Value returned by PM_GetLatencyConstraint() when no latency request is active.
+ */
+#define PM_LATENCY_NO_CONSTRAINT (0xFFFFFFFFUL)
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_QOS) && FSL_PM_SUPPORT_LATENCY_QOS)
+/*!
+ * @brief Latency QoS request object structure, allocated by the client and used as handle of its request.
+ */
+typedef struct _pm_latency_request
+{
+    list_element_t link; /*!< For placing on the latency request list, sorted by increasing maxLatency. */
+    uint32_t maxLatency; /*!< Maximum wakeup latency tolerated by the client, in us. */
+} pm_latency_request_t;
+#endif /* FSL_PM_SUPPORT_LATENCY_QOS */
+
+#if (defined(FSL_PM_SUPPORT_TIMED_CONSTRAINTS) && FSL_PM_SUPPORT_TIMED_CONSTRAINTS)
+/*!
+ * @brief Timed resource constraint object structure.
+ *
+ * After PM_ReleaseTimedConstraint() the resource constraint stays set during the delay, so that a new
+ * PM_AcquireTimedConstraint() within the delay does not pay the resource start-up cost again.
+ */
+typedef struct _pm_timed_constraint
+{
+    list_element_t link;       /*!< For placing on the pending release list. */
+    int32_t rescConstraint;    /*!< Resource constraint, as encoded by PM_ENCODE_RESC(). */
+    uint64_t delay;            /*!< Grace period before the constraint is released, in us. */
+    uint64_t releaseTimestamp; /*!< Timestamp of the last PM_ReleaseTimedConstraint(). */
+    bool held : 1U;            /*!< Resource constraint currently set. */
+    bool pending : 1U;         /*!< Release requested, waiting for the delay to elapse. */
+} pm_timed_constraint_t;
+#endif /* FSL_PM_SUPPORT_TIMED_CONSTRAINTS */
+
 /*!
  * @brief The definition of Power manager resource constraint group, the group contains the operation mode of each
  * constraint.
@@ -245,6 +422,10 @@ typedef struct _pm_state
     uint32_t exitLatency;              /*!< The latency that the power state need to exit, in us */
     pm_resc_mask_t fixConstraintsMask; /*!< Some constraints that must be satisfied in the power state. */
     pm_resc_mask_t varConstraintsMask; /*!< Some optional and configurable constraints. */
+#if (defined(FSL_PM_SUPPORT_GOVERNOR) && FSL_PM_SUPPORT_GOVERNOR)
+    uint32_t breakEvenTime; /*!< Shortest residency for which the power state saves energy, transition costs included,
+                                 in us. 0 means exitLatency. */
+#endif                      /* FSL_PM_SUPPORT_GOVERNOR */
 } pm_state_t;
 
 /*!
@@ -267,6 +448,12 @@ typedef struct _pm_device_option
     bool (*isWakeupSource)(
         pm_wakeup_source_t *ws); /*!< Used to know if the wake up source triggered the last wake up. */
 #endif                           /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
+
+#if (defined(FSL_PM_SUPPORT_RESOURCE_DEPENDENCY) && FSL_PM_SUPPORT_RESOURCE_DEPENDENCY)
+    const pm_resc_mask_t *rescDependency; /*!< Array of PM_CONSTRAINT_COUNT masks indexed by resource, each one lists
+                                              all the resources (prerequisites of prerequisites included) needed by
+                                              the resource when it is fully on. */
+#endif                                    /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
 } pm_device_option_t;
 
 #if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
@@ -274,11 +461,71 @@ typedef void (*pm_low_power_timer_start_func_t)(uint64_t timeout);
 typedef void (*pm_low_power_timer_stop_func_t)(void);
 typedef uint64_t (*pm_low_power_timer_get_timestamp_func_t)(void);
 typedef uint64_t (*pm_low_power_timer_get_duration_func_t)(uint64_t entryTimestamp, uint64_t exitTimestamp);
+typedef bool (*pm_low_power_timer_rearm_func_t)(void);
 #endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
 
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+/*!
+ * @brief num / den as a Q32.32 fixed-point factor, rounded down.
+ */
+#define PM_TIME_BASE_Q32(num, den) ((((uint64_t)(num)) << 32U) / (uint64_t)(den))
+
+/*!
+ * @brief Initializer of a @ref pm_time_base_t for a low power timer running at freq Hz.
+ *
+ * The conversion factors are computed by the compiler when freq is a constant, the conversions only multiply.
+ */
+#define PM_TIME_BASE_INIT(freq)                                                                     \
+    {                                                                                               \
+        .tickFreq = (uint32_t)(freq), .ticksToUs = PM_TIME_BASE_Q32(1000000UL, (freq)),             \
+        .usToTicks = PM_TIME_BASE_Q32((freq), 1000000UL)                                            \
+    }
+
+/*!
+ * @brief Time base of the low power timer, converts the timer ticks to and from microseconds.
+ */
+typedef struct _pm_time_base
+{
+    uint32_t tickFreq;  /*!< Frequency of the low power timer in Hz. */
+    uint64_t ticksToUs; /*!< Microseconds per tick, Q32.32 fixed point. */
+    uint64_t usToTicks; /*!< Ticks per microsecond, Q32.32 fixed point. */
+} pm_time_base_t;
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+
 typedef void (*pm_enter_critical)(void);
 typedef void (*pm_exit_critical)(void);
 
+#if (defined(FSL_PM_SUPPORT_LATENCY_CALIBRATION) && FSL_PM_SUPPORT_LATENCY_CALIBRATION)
+typedef uint32_t (*pm_latency_get_timestamp_func_t)(void);
+typedef uint32_t (*pm_latency_get_duration_func_t)(uint32_t entryTimestamp, uint32_t exitTimestamp);
+#endif /* FSL_PM_SUPPORT_LATENCY_CALIBRATION */
+
+#if (defined(FSL_PM_SUPPORT_GOVERNOR) && FSL_PM_SUPPORT_GOVERNOR)
+/*!
+ * @brief Inputs of the governor, gathered by the power manager before each low power entry.
+ */
+typedef struct _pm_governor_input
+{
+    uint32_t allowedStates; /*!< Bit n is set if the resource, power mode and latency QoS constraints allow the power
+                                 state n. The duration is not checked. */
+    uint64_t duration;      /*!< Expected low power duration, 0 if unknown. */
+    uint32_t maxLatency;    /*!< Smallest latency QoS request in us, PM_LATENCY_NO_CONSTRAINT if none. */
+    uint8_t lastState;      /*!< Power state of the last low power period, 0xFF if none yet. */
+    uint64_t lastResidency; /*!< Measured duration of the last low power period, 0 if unknown. */
+} pm_governor_input_t;
+
+struct _pm_handle;
+
+/*!
+ * @brief Governor function, chooses the power state to enter.
+ *
+ * @param handle Pointer to the power manager handle, the governor can keep its state in it.
+ * @param input Pointer to the governor inputs.
+ * @return The index of a power state set in input->allowedStates, or 0xFF to stay in active mode.
+ */
+typedef uint8_t (*pm_governor_func_t)(struct _pm_handle *handle, const pm_governor_input_t *input);
+#endif /* FSL_PM_SUPPORT_GOVERNOR */
+
 /*!
  * @brief Handle structure for power manager.
  *
@@ -293,18 +540,35 @@ typedef struct _pm_handle
 
     pm_resc_mask_t resConstraintMask;                /*!< Current system's resource constraint mask. */
     pm_resc_mask_t softConstraints;                  /*!< Current system's optional resource constraint mask. */
-    uint8_t resConstraintCount[PM_CONSTRAINT_COUNT]; /*!< The count of each resource constraint, if the constraint's
-                                                    count is 0, it means the system has removed that contraint. */
+    pm_constraint_count_t resConstraintCount[PM_CONSTRAINT_COUNT]; /*!< The count of each resource constraint, if the
+                                                    constraint's count is 0, it means the system has removed that
+                                                    contraint. */
+    pm_constraint_count_t rescOpModeCount[PM_CONSTRAINT_COUNT][PM_RESOURCE_OP_MODE_NUM]; /*!< The count of each
+                                                    operate mode requested for each resource constraint. */
 
     pm_resc_group_t sysRescGroup; /*!< Current system's resource constraint group. */
 
-    uint8_t powerModeConstraint;                         /*!< Used to store system allowed lowest power mode. */
-    uint8_t powerModeConstraintCount[PM_LP_STATE_COUNT]; /*!< The count of each power mode constraint. */
+    uint8_t powerModeConstraint; /*!< Used to store system allowed lowest power mode. */
+    pm_constraint_count_t powerModeConstraintCount[PM_LP_STATE_COUNT]; /*!< The count of each power mode constraint. */
+
+#if (defined(FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING) && FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING)
+    pm_constraint_owner_record_t ownerTable[PM_CONSTRAINT_OWNER_TABLE_SIZE]; /*!< Holders of owned constraints. */
+#endif /* FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING */
 
 #if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
+#if !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
     list_label_t notifyList[3U];           /*!< The header of 3 group notification. */
+#endif                                     /* FSL_PM_SUPPORT_STATIC_TABLES */
     pm_notify_group_t curNotifyGroup;      /*!< Store current notification group. */
     pm_notify_element_t *curNotifyElement; /*!< Store current notification element. */
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+    uint32_t notifyLatencyBudget[PM_LP_STATE_COUNT]; /*!< Sum of the exit latency budgets of the notifiers
+                                                          registered for each power state, in us. */
+#endif                            /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+#if (defined(FSL_PM_SUPPORT_DEFERRED_NOTIFY) && FSL_PM_SUPPORT_DEFERRED_NOTIFY)
+    uint8_t deferredNotifyCount; /*!< Number of notifiers whose exit callback is pending. */
+    uint8_t deferredNotifyState; /*!< The power state exited, passed to the pending exit callbacks. */
+#endif                           /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
 #endif                                     /* FSL_PM_SUPPORT_NOTIFICATION */
 
 #if (defined(FSL_PM_SUPPORT_LP_TIMER_CONTROLLER) && FSL_PM_SUPPORT_LP_TIMER_CONTROLLER)
@@ -316,16 +580,58 @@ typedef struct _pm_handle
                                                                low power mode to be able to compute the duration */
     pm_low_power_timer_get_duration_func_t getTimerDuration; /*!< This function can be used to retrun the actual
                                                                   low power duration based on the entry/exit timestamps */
+    pm_low_power_timer_rearm_func_t timerRearm; /*!< Called on each wakeup, returns true when the low power timer only
+                                                     completed an intermediate period of a long duration, the same low
+                                                     power state is then entered again. */
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+    const pm_time_base_t *timeBase; /*!< Frequency of the low power timer, NULL if the durations are not converted. */
+#endif                              /* FSL_PM_SUPPORT_TIME_BASE */
     uint64_t entryTimestamp;
     uint64_t exitTimestamp;
+#if (defined(FSL_PM_SUPPORT_DEADLINE) && FSL_PM_SUPPORT_DEADLINE)
+    bool deadlineRequested;    /*!< The current low power entry was requested by PM_EnterLowPowerUntil(). */
+    uint64_t deadline;         /*!< Timestamp at which the execution must resume. */
+    uint64_t requestTimestamp; /*!< Timestamp of the PM_EnterLowPowerUntil() call. */
+    uint64_t entryOverhead;    /*!< Average time between the request and the low power timer start. */
+    status_t entryStatus;      /*!< Status of the last PM_EnterLowPower() call, returned by PM_EnterLowPowerUntil(). */
+#endif                         /* FSL_PM_SUPPORT_DEADLINE */
 #endif                                                 /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
 
-#if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
+#if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && \
+    !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
     list_label_t wakeupSourceList;
 #endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
 
+#if (defined(FSL_PM_SUPPORT_TIMED_CONSTRAINTS) && FSL_PM_SUPPORT_TIMED_CONSTRAINTS)
+    list_label_t timedConstraintList; /*!< Timed constraints waiting for their delay to elapse. */
+#endif /* FSL_PM_SUPPORT_TIMED_CONSTRAINTS */
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_QOS) && FSL_PM_SUPPORT_LATENCY_QOS)
+    list_label_t latencyRequestList; /*!< Active latency requests, the head holds the smallest one. */
+#endif /* FSL_PM_SUPPORT_LATENCY_QOS */
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_CALIBRATION) && FSL_PM_SUPPORT_LATENCY_CALIBRATION)
+    pm_latency_get_timestamp_func_t latencyGetTimestamp; /*!< Timestamp function of the calibration, in us. */
+    pm_latency_get_duration_func_t latencyGetDuration;   /*!< Duration between two calibration timestamps, in us. */
+    uint32_t exitLatency[PM_LP_STATE_COUNT]; /*!< RAM copy of the exit latencies, measured or set by software, in us. */
+    uint32_t calibratedStates;      /*!< Bit n is set if exitLatency[n] is valid, the board value is used otherwise. */
+    uint32_t calibrationTimestamp;  /*!< Timestamp taken before entering the low power state being calibrated. */
+    uint32_t calibrationPeriod;     /*!< Low power period of the calibration in progress, in us. */
+    uint8_t calibrationAttempts;    /*!< Attempts ended early by another wakeup source since the request. */
+    bool calibrationRequested;      /*!< A calibration is done on next low power entry. */
+#endif                              /* FSL_PM_SUPPORT_LATENCY_CALIBRATION */
+
+#if (defined(FSL_PM_SUPPORT_GOVERNOR) && FSL_PM_SUPPORT_GOVERNOR)
+    pm_governor_func_t governor; /*!< Policy choosing the power state among the allowed ones. */
+    uint8_t lastState;           /*!< Power state of the last low power period, 0xFF if none yet. */
+    uint64_t lastResidency;      /*!< Measured duration of the last low power period, 0 if unknown. */
+    uint8_t ladderState;         /*!< Deepest power state currently granted by PM_GovernorLadder(). */
+    uint8_t ladderCount;         /*!< Consecutive residencies long enough to promote the ladder. */
+#endif                           /* FSL_PM_SUPPORT_GOVERNOR */
+
     pm_enter_critical enterCritical; /* Power manager critical entry function, default set as NULL. */
     pm_exit_critical exitCritical;   /* Power manager critical exit function, default set as NULL. */
+    uint32_t criticalMask;           /*!< Interrupt mask saved by the default critical region. */
 } pm_handle_t;
 
 #if defined(__cplusplus)
@@ -341,10 +647,27 @@ extern "C" {
  * @{
  */
 
+/*!
+ * @brief Initialize a power manager handle, without making it the default handle.
+ *
+ * Each handle is an independent power manager instance with its own constraints, notifiers, wakeup sources and
+ * timer controller. It is used with the ByHandle variants of the APIs, for example one instance per core, or several
+ * simulated devices in one host process. When FSL_PM_SUPPORT_STATIC_TABLES is enabled, the notifier and wakeup source
+ * tables are shared by all the handles.
+ *
+ * @note In default, the power manager is disabled.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure, upper layer software should pre-allocate the handle.
+ * @param deviceOption Power states and sequences of the device, NULL for the ones of the board.
+ */
+void PM_InitHandle(pm_handle_t *handle, pm_device_option_t *deviceOption);
+
 /*!
  * @brief Initialize the power manager handle, this function should be invoked before using other power manager
  * APIs.
  *
+ * The handle becomes the default handle, used by the APIs that do not take a handle.
+ *
  * @note In default, the power manager is disabled.
  *
  * @param handle Pointer to the @ref pm_handle_t structure, upper layer software should pre-allocate the handle global
@@ -352,6 +675,27 @@ extern "C" {
  */
 void PM_CreateHandle(pm_handle_t *handle);
 
+/*!
+ * @brief Set the default handle, used by the APIs that do not take a handle.
+ *
+ * @param handle Pointer to a handle initialized with PM_InitHandle() or PM_CreateHandle().
+ */
+void PM_SetDefaultHandle(pm_handle_t *handle);
+
+/*!
+ * @brief Get the default handle, used by the APIs that do not take a handle.
+ *
+ * @return The default handle, NULL if PM_CreateHandle() was not called.
+ */
+pm_handle_t *PM_GetDefaultHandle(void);
+
+/*!
+ * @brief Same as PM_EnablePowerManager(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+void PM_EnablePowerManagerByHandle(pm_handle_t *handle, bool enable);
+
 /*!
  * @brief Enable/disable power manager functions.
  *
@@ -359,6 +703,13 @@ void PM_CreateHandle(pm_handle_t *handle);
  */
 void PM_EnablePowerManager(bool enable);
 
+/*!
+ * @brief Same as PM_EnterLowPower(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+void PM_EnterLowPowerByHandle(pm_handle_t *handle, uint64_t duration);
+
 /*!
  * @brief Power manager core API, this API should be used on RTOS's IDLE task.
  *
@@ -374,7 +725,8 @@ void PM_EnablePowerManager(bool enable);
  *   b. resConstraintsMask logical AND state's lossFeature should equal to 0, because constraint can be understand as
  * some features can not loss.
  *
- * @param duration The time in low power mode, this value is calculate from RTOS API.
+ * @param duration The time in low power mode, this value is calculate from RTOS API. In low power timer ticks
+ *                 when a time base is registered with PM_RegisterTimeBase().
  */
 void PM_EnterLowPower(uint64_t duration);
 
@@ -399,10 +751,101 @@ void PM_RegisterTimerController(pm_handle_t *handle,
                                 pm_low_power_timer_get_timestamp_func_t getTimestamp,
                                 pm_low_power_timer_get_duration_func_t getTimerDuration);
 
+/*!
+ * @brief Register the re-arm function of the low power timer.
+ *
+ * A low power timer that cannot cover the requested duration in one period wakes the device up at the end of each
+ * intermediate period. The re-arm function is called after each wakeup with the interrupts masked, it returns true
+ * when the wakeup was caused by such an intermediate period and the timer is running again. The low power state is
+ * then entered again without notifying the exit.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ * @param timerRearm Low power timer re-arm function, NULL when the timer always covers the duration in one period.
+ */
+void PM_RegisterTimerRearm(pm_handle_t *handle, pm_low_power_timer_rearm_func_t timerRearm);
+
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+/*!
+ * @brief Register the time base of the low power timer.
+ *
+ * Once registered, the durations given to PM_EnterLowPower() and PM_findDeepestState() and given to the timerStart
+ * function are in ticks of the low power timer. The policy converts them to microseconds, the unit of the exit
+ * latencies, of the latency QoS requests, of the timed constraint delays and of the getTimerDuration function.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ * @param timeBase Pointer to the time base, usually initialized with PM_TIME_BASE_INIT(). NULL disables the conversions.
+ */
+void PM_RegisterTimeBase(pm_handle_t *handle, const pm_time_base_t *timeBase);
+
+/*!
+ * @brief Same as PM_TicksToUs(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+uint64_t PM_TicksToUsByHandle(pm_handle_t *handle, uint64_t ticks);
+
+/*!
+ * @brief Convert low power timer ticks to microseconds with the registered time base.
+ *
+ * @param ticks Number of ticks.
+ * @return The number of microseconds rounded down, ticks if no time base is registered.
+ */
+uint64_t PM_TicksToUs(uint64_t ticks);
+
+/*!
+ * @brief Same as PM_UsToTicks(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+uint64_t PM_UsToTicksByHandle(pm_handle_t *handle, uint64_t us);
+
+/*!
+ * @brief Convert microseconds to low power timer ticks with the registered time base.
+ *
+ * @param us Number of microseconds.
+ * @return The number of ticks rounded down, us if no time base is registered.
+ */
+uint64_t PM_UsToTicks(uint64_t us);
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+
+/*!
+ * @brief Same as PM_GetLastLowPowerDuration(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+uint64_t PM_GetLastLowPowerDurationByHandle(pm_handle_t *handle);
+
 /*!
  * @brief Get the actual low power state duration.
+ *
+ * @return The duration returned by the getTimerDuration function of the timer controller, 0 if no such function is
+ * registered.
  */
 uint64_t PM_GetLastLowPowerDuration(void);
+
+#if (defined(FSL_PM_SUPPORT_DEADLINE) && FSL_PM_SUPPORT_DEADLINE)
+/*!
+ * @brief Same as PM_EnterLowPowerUntil(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_EnterLowPowerUntilByHandle(pm_handle_t *handle, uint64_t deadline);
+
+/*!
+ * @brief Enter low power until an absolute deadline.
+ *
+ * Same as PM_EnterLowPower(), with the duration computed from the deadline with the getTimestamp and
+ * getTimerDuration functions of the timer controller. The power state is chosen for the duration left once the
+ * measured entry overhead is removed. Just before the low power timer is started, the remaining time is computed
+ * again, and a shallower power state is entered if the chosen one can no longer wake up in time.
+ *
+ * @param deadline Timestamp at which the execution must resume.
+ * @return kStatus_PMSuccess if a power state was entered, kStatus_PMPowerStateNotAllowed if the deadline is already
+ *         reached, the power manager is disabled or no power state can wake up in time, or the error returned by the
+ *         notifiers.
+ */
+status_t PM_EnterLowPowerUntil(uint64_t deadline);
+#endif /* FSL_PM_SUPPORT_DEADLINE */
 #endif /* FSL_PM_SUPPORT_LP_TIMER_CONTROLLER */
 
 /*!
@@ -418,6 +861,124 @@ void PM_RegisterCriticalRegionController(pm_handle_t *handle,
                                          pm_enter_critical criticalEntry,
                                          pm_exit_critical criticalExit);
 
+/*!
+ * @brief Enter the critical region of a power manager instance.
+ *
+ * Calls the function registered with PM_RegisterCriticalRegionController(). By default the interrupts are masked, the
+ * previous mask is kept in the handle so that the critical regions of different handles can nest.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+void PM_EnterCriticalRegion(pm_handle_t *handle);
+
+/*!
+ * @brief Exit the critical region of a power manager instance.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+void PM_ExitCriticalRegion(pm_handle_t *handle);
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_CALIBRATION) && FSL_PM_SUPPORT_LATENCY_CALIBRATION)
+/*!
+ * @brief Register latency calibration related functions. Those functions must use microseconds as unit.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ * @param latencyGetTimestamp Timestamping function used by the latency calibration, the timer must keep running in
+ *                            the low power states.
+ * @param latencyGetDuration Function used to compute the duration between two timestamps.
+ */
+void PM_RegisterLatencyCalibrationController(pm_handle_t *handle,
+                                             pm_latency_get_timestamp_func_t latencyGetTimestamp,
+                                             pm_latency_get_duration_func_t latencyGetDuration);
+
+/*!
+ * @brief Same as PM_RequestLatencyCalibration(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+void PM_RequestLatencyCalibrationByHandle(pm_handle_t *handle);
+
+/*!
+ * @brief Request a latency calibration.
+ *
+ * On next low power entry, the power manager puts the device in the target power state for
+ * PM_LATENCY_CALIBRATION_DURATION only, or less if the duration of the entry is shorter, and measures how late the
+ * execution resumes. The result replaces the exit latency of that state for the policy. If the duration of the entry
+ * leaves no time for the period, the calibration is retried on the following entry. If another wakeup source ends the
+ * period early, it is retried too, up to PM_LATENCY_CALIBRATION_MAX_ATTEMPTS times; the request is then dropped so
+ * that the low power entries are no longer shortened.
+ *
+ * @note Power states that exit through a reset can not be measured, use PM_SetSoftwareExitLatency() for them.
+ *       To keep the calibration over such states, place the handle in always-on RAM.
+ */
+void PM_RequestLatencyCalibration(void);
+
+/*!
+ * @brief Same as PM_SetSoftwareExitLatency(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+void PM_SetSoftwareExitLatencyByHandle(pm_handle_t *handle, uint8_t stateIndex, uint32_t exitLatency);
+
+/*!
+ * @brief Force the exit latency used by the policy for one power state.
+ *
+ * This is useful during initialization, before any calibration, or for the power states that can not be measured.
+ *
+ * @param stateIndex Power state concerned by this latency.
+ * @param exitLatency Exit latency estimated by the software, in us. PM_LATENCY_CALIBRATION_MARGIN is added to it.
+ */
+void PM_SetSoftwareExitLatency(uint8_t stateIndex, uint32_t exitLatency);
+#endif /* FSL_PM_SUPPORT_LATENCY_CALIBRATION */
+
+#if (defined(FSL_PM_SUPPORT_GOVERNOR) && FSL_PM_SUPPORT_GOVERNOR)
+/*!
+ * @brief Register the governor used to choose the power state, it can be changed at any time.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ * @param governor Governor function, such as PM_GovernorDeepestAllowed(), PM_GovernorEnergyBreakEven() or
+ *                 PM_GovernorLadder().
+ *                 NULL restores PM_GovernorDeepestAllowed().
+ */
+void PM_RegisterGovernor(pm_handle_t *handle, pm_governor_func_t governor);
+
+/*!
+ * @brief Governor choosing the deepest allowed power state that exits within the duration.
+ *
+ * This is the default governor, same as the power manager behavior without governor support.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ * @param input Pointer to the governor inputs.
+ * @return The index of the power state to enter, or 0xFF.
+ */
+uint8_t PM_GovernorDeepestAllowed(pm_handle_t *handle, const pm_governor_input_t *input);
+
+/*!
+ * @brief Governor choosing the deepest allowed power state whose break-even time fits in the duration.
+ *
+ * When the duration is unknown, the last measured residency is used as prediction.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ * @param input Pointer to the governor inputs.
+ * @return The index of the power state to enter, or 0xFF.
+ */
+uint8_t PM_GovernorEnergyBreakEven(pm_handle_t *handle, const pm_governor_input_t *input);
+
+/*!
+ * @brief Governor climbing the power states one step at a time, to avoid thrashing under periodic wakeups.
+ *
+ * The ladder promotes to the next deeper power state after PM_GOVERNOR_LADDER_PROMOTE_COUNT consecutive residencies
+ * longer than that state's break-even time, and demotes at once to the deepest state whose break-even time fits a
+ * shorter residency. The chosen state is further limited like PM_GovernorDeepestAllowed(). Without residency
+ * measurement (no timestamp function registered), this governor behaves as PM_GovernorDeepestAllowed().
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure, it holds the ladder counters.
+ * @param input Pointer to the governor inputs.
+ * @return The index of the power state to enter, or 0xFF.
+ */
+uint8_t PM_GovernorLadder(pm_handle_t *handle, const pm_governor_input_t *input);
+#endif /* FSL_PM_SUPPORT_GOVERNOR */
+
 /*! @} */
 
 #if (defined(FSL_PM_SUPPORT_NOTIFICATION) && FSL_PM_SUPPORT_NOTIFICATION)
@@ -426,6 +987,14 @@ void PM_RegisterCriticalRegionController(pm_handle_t *handle,
  * @{
  */
 
+#if !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+/*!
+ * @brief Same as PM_RegisterNotify(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_RegisterNotifyByHandle(pm_handle_t *handle, pm_notify_group_t groupId, pm_notify_element_t *notifyElement);
+
 /*!
  * @brief Register notify element into the selected group.
  *
@@ -434,6 +1003,14 @@ void PM_RegisterCriticalRegionController(pm_handle_t *handle,
  * @return status_t The status of register notify object behavior.
  */
 status_t PM_RegisterNotify(pm_notify_group_t groupId, pm_notify_element_t *notifyElement);
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+
+/*!
+ * @brief Same as PM_UpdateNotify(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+void PM_UpdateNotifyByHandle(pm_handle_t *handle, void *notifyElement, pm_notify_callback_func_t callback, void *data);
 
 /*!
  * @brief Update notify element's callback function and application data.
@@ -444,12 +1021,79 @@ status_t PM_RegisterNotify(pm_notify_group_t groupId, pm_notify_element_t *notif
  */
 void PM_UpdateNotify(void *notifyElement, pm_notify_callback_func_t callback, void *data);
 
+#if !(defined(FSL_PM_SUPPORT_STATIC_TABLES) && FSL_PM_SUPPORT_STATIC_TABLES)
+/*!
+ * @brief Same as PM_UnregisterNotify(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_UnregisterNotifyByHandle(pm_handle_t *handle, void *notifyElement);
+
 /*!
  * @brief Remove notify element from its notify group.
  *
  * @param notifyElement The pointer to the notify element to remove.
  */
 status_t PM_UnregisterNotify(void *notifyElement);
+#endif /* FSL_PM_SUPPORT_STATIC_TABLES */
+
+#if (defined(FSL_PM_SUPPORT_NOTIFY_TIMING) && FSL_PM_SUPPORT_NOTIFY_TIMING)
+/*!
+ * @brief Get the average execution time of a notifier callback.
+ *
+ * @param timing Pointer to the entryTiming or exitTiming member of a notify element.
+ * @return The average execution time in CPU cycles, 0 if the callback never ran.
+ */
+uint32_t PM_GetNotifyAverageCycles(const pm_notify_timing_t *timing);
+
+/*!
+ * @brief Same as PM_ResetNotifyTiming(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+void PM_ResetNotifyTimingByHandle(pm_handle_t *handle, pm_notify_element_t *notifyElement);
+
+/*!
+ * @brief Clear the timing statistics and the budget overrun count of a notify element.
+ *
+ * @param notifyElement The pointer to the notify element.
+ */
+void PM_ResetNotifyTiming(pm_notify_element_t *notifyElement);
+#endif /* FSL_PM_SUPPORT_NOTIFY_TIMING */
+
+#if (defined(FSL_PM_SUPPORT_DEFERRED_NOTIFY) && FSL_PM_SUPPORT_DEFERRED_NOTIFY)
+/*!
+ * @brief Same as PM_RunDeferredNotify(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+void PM_RunDeferredNotifyByHandle(pm_handle_t *handle);
+
+/*!
+ * @brief Run the pending exit callbacks of the deferred notifiers, in the exit order.
+ *
+ * This function should be called from thread context once the latency critical wakeup handling is done. Each
+ * pending callback runs once, and the pending callbacks left are run before the next power state entry.
+ */
+void PM_RunDeferredNotify(void);
+
+/*!
+ * @brief Same as PM_RunDeferredNotifyElement(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+bool PM_RunDeferredNotifyElementByHandle(pm_handle_t *handle, pm_notify_element_t *notifyElement);
+
+/*!
+ * @brief Run the exit callback of a deferred notifier if it is pending.
+ *
+ * A driver can call this function before its first access to the peripheral after a wakeup.
+ *
+ * @param notifyElement The pointer to the notify element.
+ * @return true if the exit callback was run.
+ */
+bool PM_RunDeferredNotifyElement(pm_notify_element_t *notifyElement);
+#endif /* FSL_PM_SUPPORT_DEFERRED_NOTIFY */
 
 /* @} */
 #endif /* FSL_PM_SUPPORT_NOTIFICATION */
@@ -460,6 +1104,17 @@ status_t PM_UnregisterNotify(void *notifyElement);
  * @{
  */
 
+/*!
+ * @brief Same as PM_InitWakeupSource(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+void PM_InitWakeupSourceByHandle(pm_handle_t *handle,
+                                 pm_wakeup_source_t *ws,
+                                 uint32_t wsId,
+                                 pm_wake_up_source_service_func_t service,
+                                 bool enable);
+
 /*!
  * @brief Initialize the wakeup source object.
  *
@@ -470,6 +1125,13 @@ status_t PM_UnregisterNotify(void *notifyElement);
  */
 void PM_InitWakeupSource(pm_wakeup_source_t *ws, uint32_t wsId, pm_wake_up_source_service_func_t service, bool enable);
 
+/*!
+ * @brief Same as PM_EnableWakeupSource(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_EnableWakeupSourceByHandle(pm_handle_t *handle, pm_wakeup_source_t *ws);
+
 /*!
  * @brief Enable wakeup source.
  *
@@ -478,6 +1140,13 @@ void PM_InitWakeupSource(pm_wakeup_source_t *ws, uint32_t wsId, pm_wake_up_sourc
  */
 status_t PM_EnableWakeupSource(pm_wakeup_source_t *ws);
 
+/*!
+ * @brief Same as PM_DisableWakeupSource(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_DisableWakeupSourceByHandle(pm_handle_t *handle, pm_wakeup_source_t *ws);
+
 /*!
  * @brief Disable wakeup source
  *
@@ -486,6 +1155,13 @@ status_t PM_EnableWakeupSource(pm_wakeup_source_t *ws);
  */
 status_t PM_DisableWakeupSource(pm_wakeup_source_t *ws);
 
+/*!
+ * @brief Same as PM_HandleWakeUpEvent(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_HandleWakeUpEventByHandle(pm_handle_t *handle);
+
 /*!
  * @brief Checks if any enabled wake up source is responsible for last wake up
  *       event. In such case, it will call the wake up source callback if it
@@ -495,6 +1171,13 @@ status_t PM_DisableWakeupSource(pm_wakeup_source_t *ws);
  */
 status_t PM_HandleWakeUpEvent(void);
 
+/*!
+ * @brief Same as PM_TriggerWakeSourceService(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_TriggerWakeSourceServiceByHandle(pm_handle_t *handle, pm_wakeup_source_t *ws);
+
 /*!
  * @brief If the specfic wakeup event occurs, invoke this API to execute its service function.
  *
@@ -510,6 +1193,13 @@ status_t PM_TriggerWakeSourceService(pm_wakeup_source_t *ws);
  * @{
  */
 
+/*!
+ * @brief Same as PM_SetConstraints(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_SetConstraintsByHandle(pm_handle_t *handle, uint8_t powerModeConstraint, int32_t rescNum, ...);
+
 /*!
  * @brief Used to set constraints(including power mode constraint and resource constraints)
  *
@@ -521,10 +1211,19 @@ status_t PM_TriggerWakeSourceService(pm_wakeup_source_t *ws);
  * @param powerModeConstraint The lowest power mode allowed, the power mode constraint macros
  *                            can be found in fsl_pm_board.h
  * @param rescNum The number of resource constraints to be set.
- * @return status_t The status of set constraints behavior.
+ * @retval kStatus_PMConstraintCountOverflow The counter of one of the constraints is saturated. None of the
+ *         constraints of the call is set, the ones set before the failing one are released.
+ * @return status_t The status of set constraints behavior, the one of the failing constraint.
  */
 status_t PM_SetConstraints(uint8_t powerModeConstraint, int32_t rescNum, ...);
 
+/*!
+ * @brief Same as PM_ReleaseConstraints(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_ReleaseConstraintsByHandle(pm_handle_t *handle, uint8_t powerModeConstraint, int32_t rescNum, ...);
+
 /*!
  * @brief Used to release constraints(including power mode constraint and resource constraints)
  *
@@ -540,6 +1239,108 @@ status_t PM_SetConstraints(uint8_t powerModeConstraint, int32_t rescNum, ...);
  */
 status_t PM_ReleaseConstraints(uint8_t powerModeConstraint, int32_t rescNum, ...);
 
+#if (defined(FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING) && FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING)
+/*!
+ * @brief Same as PM_SetOwnedConstraints(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_SetOwnedConstraintsByHandle(pm_handle_t *handle,
+                                        pm_constraint_owner_t owner,
+                                        uint8_t powerModeConstraint,
+                                        int32_t rescNum,
+                                        ...);
+
+/*!
+ * @brief Same as PM_SetConstraints(), and records owner as a holder of each constraint set.
+ *
+ *  @code
+ *      PM_SetOwnedConstraints(APP_OWNER_UART, PM_LP_STATE_NO_CONSTRAINT, 1, PM_RESC_FRO_144M_ON);
+ *  @endcode
+ *
+ * @param owner Client id of the caller, chosen by the application.
+ * @param powerModeConstraint The lowest power mode allowed, the power mode constraint macros
+ *                            can be found in fsl_pm_board.h
+ * @param rescNum The number of resource constraints to be set.
+ * @retval kStatus_PMConstraintOwnerTableFull No free record left for one of the constraints. None of the
+ *         constraints of the call is set nor recorded.
+ * @return status_t The status of set constraints behavior, the one of the failing constraint.
+ */
+status_t PM_SetOwnedConstraints(pm_constraint_owner_t owner, uint8_t powerModeConstraint, int32_t rescNum, ...);
+
+/*!
+ * @brief Same as PM_ReleaseOwnedConstraints(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_ReleaseOwnedConstraintsByHandle(pm_handle_t *handle,
+                                            pm_constraint_owner_t owner,
+                                            uint8_t powerModeConstraint,
+                                            int32_t rescNum,
+                                            ...);
+
+/*!
+ * @brief Same as PM_ReleaseConstraints(), for constraints set with PM_SetOwnedConstraints().
+ *
+ * @param owner Client id that set the constraints.
+ * @param powerModeConstraint The power mode constraint to release.
+ * @param rescNum The number of resource constraints to be released.
+ * @retval kStatus_PMConstraintNotOwned The owner does not hold one of the constraints, that constraint is left set.
+ * @return status_t The status of release constraints behavior.
+ */
+status_t PM_ReleaseOwnedConstraints(pm_constraint_owner_t owner, uint8_t powerModeConstraint, int32_t rescNum, ...);
+
+/*!
+ * @brief Same as PM_GetConstraintOwners(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+uint8_t PM_GetConstraintOwnersByHandle(pm_handle_t *handle,
+                                       uint32_t rescIndex,
+                                       pm_constraint_owner_t *owners,
+                                       uint8_t maxOwners);
+
+/*!
+ * @brief Get the owners currently holding a resource constraint.
+ *
+ * Combined with the resc_num reported by PM_findDeepestState() this tells which clients keep the device in a
+ * shallower state. Constraints set with PM_SetConstraints() have no owner and are not reported.
+ *
+ * @param rescIndex Index of the resource, see resc_name_t in fsl_pm_board.h.
+ * @param owners Output array of owner ids, can be NULL if maxOwners is 0.
+ * @param maxOwners Size of the owners array.
+ * @return Number of owners holding the constraint, may be larger than maxOwners.
+ */
+uint8_t PM_GetConstraintOwners(uint32_t rescIndex, pm_constraint_owner_t *owners, uint8_t maxOwners);
+
+/*!
+ * @brief Same as PM_GetPowerModeConstraintOwners(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+uint8_t PM_GetPowerModeConstraintOwnersByHandle(pm_handle_t *handle,
+                                                uint8_t powerMode,
+                                                pm_constraint_owner_t *owners,
+                                                uint8_t maxOwners);
+
+/*!
+ * @brief Get the owners currently holding a power mode constraint.
+ *
+ * @param powerMode Power mode index, the macros can be found in fsl_pm_board.h.
+ * @param owners Output array of owner ids, can be NULL if maxOwners is 0.
+ * @param maxOwners Size of the owners array.
+ * @return Number of owners holding the constraint, may be larger than maxOwners.
+ */
+uint8_t PM_GetPowerModeConstraintOwners(uint8_t powerMode, pm_constraint_owner_t *owners, uint8_t maxOwners);
+#endif /* FSL_PM_SUPPORT_CONSTRAINT_OWNER_TRACKING */
+
+/*!
+ * @brief Same as PM_GetResourceConstraintsMask(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+pm_resc_mask_t PM_GetResourceConstraintsMaskByHandle(pm_handle_t *handle);
+
 /*!
  * @brief Get current system resource constraints.
  *
@@ -547,6 +1348,13 @@ status_t PM_ReleaseConstraints(uint8_t powerModeConstraint, int32_t rescNum, ...
  */
 pm_resc_mask_t PM_GetResourceConstraintsMask(void);
 
+/*!
+ * @brief Same as PM_GetAllowedLowestPowerMode(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+uint8_t PM_GetAllowedLowestPowerModeByHandle(pm_handle_t *handle);
+
 /*!
  * @brief Get current system allowed power mode.
  *
@@ -554,12 +1362,143 @@ pm_resc_mask_t PM_GetResourceConstraintsMask(void);
  */
 uint8_t PM_GetAllowedLowestPowerMode(void);
 
+#if (defined(FSL_PM_SUPPORT_TIMED_CONSTRAINTS) && FSL_PM_SUPPORT_TIMED_CONSTRAINTS)
+/*!
+ * @brief Initialize a timed resource constraint object.
+ *
+ *  @code
+ *      static pm_timed_constraint_t s_pllConstraint;
+ *      PM_InitTimedConstraint(&s_pllConstraint, PM_RESC_PLL0_ON, 20000U);
+ *  @endcode
+ *
+ * @param timedConstraint Pointer to the timed constraint object.
+ * @param rescConstraint Resource constraint to hold, as encoded by PM_ENCODE_RESC().
+ * @param delay Grace period before the constraint is really released, in us, the unit of the exit latencies and of
+ *              the getTimerDuration function. 0 releases the constraint immediately.
+ */
+void PM_InitTimedConstraint(pm_timed_constraint_t *timedConstraint, int32_t rescConstraint, uint64_t delay);
+
+/*!
+ * @brief Same as PM_AcquireTimedConstraint(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_AcquireTimedConstraintByHandle(pm_handle_t *handle, pm_timed_constraint_t *timedConstraint);
+
+/*!
+ * @brief Set the resource constraint of a timed constraint object.
+ *
+ * If a release is pending, it is cancelled and the resource is kept without any new set request.
+ *
+ * @param timedConstraint Pointer to the timed constraint object.
+ * @return status_t The status of set constraints behavior.
+ */
+status_t PM_AcquireTimedConstraint(pm_timed_constraint_t *timedConstraint);
+
+/*!
+ * @brief Same as PM_ReleaseTimedConstraint(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_ReleaseTimedConstraintByHandle(pm_handle_t *handle, pm_timed_constraint_t *timedConstraint);
+
+/*!
+ * @brief Release the resource constraint of a timed constraint object after its delay.
+ *
+ * The constraint is released by PM_EnterLowPower() once the delay has elapsed, the idle duration passed to
+ * PM_EnterLowPower() is shortened so that the device wakes up when the delay expires. Without timestamp or duration
+ * function registered in the timer controller, the constraint is released immediately.
+ *
+ * @param timedConstraint Pointer to the timed constraint object.
+ * @return status_t The status of release constraints behavior.
+ */
+status_t PM_ReleaseTimedConstraint(pm_timed_constraint_t *timedConstraint);
+#endif /* FSL_PM_SUPPORT_TIMED_CONSTRAINTS */
+
+#if (defined(FSL_PM_SUPPORT_LATENCY_QOS) && FSL_PM_SUPPORT_LATENCY_QOS)
+/*!
+ * @brief Same as PM_AddLatencyRequest(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_AddLatencyRequestByHandle(pm_handle_t *handle, pm_latency_request_t *request, uint32_t maxLatency);
+
+/*!
+ * @brief Register a maximum wakeup latency request.
+ *
+ * While the request is active, power states whose exit latency exceeds maxLatency are not selected by the policy.
+ *
+ *  @code
+ *      static pm_latency_request_t s_commsLatency;
+ *      PM_AddLatencyRequest(&s_commsLatency, 300U);
+ *  @endcode
+ *
+ * @param request Pointer to the request object, it must stay allocated until the request is removed.
+ * @param maxLatency Maximum wakeup latency tolerated by the client, in us.
+ * @return status_t The status of add latency request behavior.
+ */
+status_t PM_AddLatencyRequest(pm_latency_request_t *request, uint32_t maxLatency);
+
+/*!
+ * @brief Same as PM_UpdateLatencyRequest(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_UpdateLatencyRequestByHandle(pm_handle_t *handle, pm_latency_request_t *request, uint32_t maxLatency);
+
+/*!
+ * @brief Update the maximum wakeup latency of an active request.
+ *
+ * @param request Pointer to the request object previously added with PM_AddLatencyRequest().
+ * @param maxLatency New maximum wakeup latency, in us.
+ * @return status_t The status of update latency request behavior.
+ */
+status_t PM_UpdateLatencyRequest(pm_latency_request_t *request, uint32_t maxLatency);
+
+/*!
+ * @brief Same as PM_RemoveLatencyRequest(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+status_t PM_RemoveLatencyRequestByHandle(pm_handle_t *handle, pm_latency_request_t *request);
+
+/*!
+ * @brief Remove a latency request.
+ *
+ * @param request Pointer to the request object to remove.
+ * @return status_t The status of remove latency request behavior.
+ */
+status_t PM_RemoveLatencyRequest(pm_latency_request_t *request);
+
+/*!
+ * @brief Same as PM_GetLatencyConstraint(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+uint32_t PM_GetLatencyConstraintByHandle(pm_handle_t *handle);
+
+/*!
+ * @brief Get the smallest maximum wakeup latency over the active requests.
+ *
+ * @return The latency in us, or PM_LATENCY_NO_CONSTRAINT if no request is active.
+ */
+uint32_t PM_GetLatencyConstraint(void);
+#endif /* FSL_PM_SUPPORT_LATENCY_QOS */
+
+/*!
+ * @brief Same as PM_findDeepestState(), on the power manager instance given by handle.
+ *
+ * @param handle Pointer to the @ref pm_handle_t structure
+ */
+void PM_findDeepestStateByHandle(pm_handle_t *handle, uint64_t duration, pm_deepest_state_results_t *results);
+
 /*!
  * @brief Finds the Deepest power state allowed by the current
  * constraints.  Returns a structure that caller can use to
  * determine why this is deepest state allowed.
  *
- * @param duration input the duration to stay in low-power state
+ * @param duration input the duration to stay in low-power state, in low power timer ticks when a time base is
+ *                 registered with PM_RegisterTimeBase()
  * @param results output pointer to structure for caller:
  *          - deepestState: allowed lowest power mode
  *          - reason: why deeper mode was not allowed
@@ -0,0 +1,610 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_PM_HPP_
+#define _FSL_PM_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "fsl_pm_core.h"
+#include "fsl_pm_board.h"
+
+/*!
+ * @addtogroup PM Framework: Power Manager Framework
+ * @{
+ */
+
+/*!
+ * @name C++17 binding
+ *
+ * Header-only binding of the power manager for C++17 applications. Constraint sets and power state tables are built
+ * and checked at compile time, and the calls made at run time are the ones of the C API with constant arguments, no
+ * table is built and nothing is allocated.
+ *
+ * A constraint set must be a constexpr object at namespace scope, or a static data member, so that it can be used as
+ * template argument of pm::ScopedConstraint:
+ * @code
+ * constexpr auto kUartConstraints = pm::ConstraintSet<>(PM_LP_STATE_DEEP_SLEEP)
+ *                                       .with(PM_RESC_FRO_12M_ON)
+ *                                       .with(kResc_FRO_144M, pm::OpMode::FullOn);
+ *
+ * void UART_Transfer(void)
+ * {
+ *     pm::ScopedConstraint<kUartConstraints> constraints;
+ *     // Same as PM_SetConstraints(PM_LP_STATE_DEEP_SLEEP, 2, PM_RESC_FRO_12M_ON, PM_RESC_FRO_144M_ON), released by
+ *     // PM_ReleaseConstraints() at the end of the scope.
+ * }
+ * @endcode
+ * @{
+ */
+
+namespace pm
+{
+/*! @brief Operating mode requested for a resource, see PM_ENCODE_RESC(). */
+enum class OpMode : uint32_t
+{
+    PartOn1 = PM_RESOURCE_PARTABLE_ON1, /*!< First partable on mode of the resource. */
+    PartOn2 = PM_RESOURCE_PARTABLE_ON2, /*!< Second partable on mode of the resource. */
+    FullOn  = PM_RESOURCE_FULL_ON,      /*!< Resource fully on. */
+};
+
+/*! @brief Resource constraint, as encoded by PM_ENCODE_RESC(). */
+class Resource
+{
+  public:
+    /*!
+     * @brief Constraint keeping a resource in the given operating mode.
+     *
+     * @param index Index of the resource, for example kResc_FRO_144M.
+     * @param mode Operating mode requested for the resource.
+     */
+    constexpr explicit Resource(uint32_t index, OpMode mode = OpMode::FullOn) noexcept
+        : m_encoded(PM_ENCODE_RESC(static_cast<uint32_t>(mode), index))
+    {
+    }
+
+    /*!
+     * @brief Constraint given by its encoded value, for example PM_RESC_FRO_144M_ON.
+     */
+    static constexpr Resource fromEncoded(uint32_t encoded) noexcept
+    {
+        return Resource(encoded, 0);
+    }
+
+    /*! @brief Encoded value, as passed to PM_SetConstraints(). */
+    constexpr uint32_t encoded() const noexcept
+    {
+        return m_encoded;
+    }
+
+    /*! @brief Index of the resource. */
+    constexpr uint32_t index() const noexcept
+    {
+        return m_encoded & 0xFFUL;
+    }
+
+    /*! @brief Operating mode requested for the resource, one of the PM_RESOURCE_xxx values. */
+    constexpr uint32_t opMode() const noexcept
+    {
+        return m_encoded >> 8UL;
+    }
+
+    /*! @brief Check the resource exists on the device and the operating mode is one the power manager supports. */
+    constexpr bool isValid() const noexcept
+    {
+        return (index() < (uint32_t)PM_CONSTRAINT_COUNT) &&
+               ((opMode() == PM_RESOURCE_PARTABLE_ON1) || (opMode() == PM_RESOURCE_PARTABLE_ON2) ||
+                (opMode() == PM_RESOURCE_FULL_ON));
+    }
+
+  private:
+    constexpr Resource(uint32_t encoded, int) noexcept : m_encoded(encoded)
+    {
+    }
+
+    uint32_t m_encoded;
+};
+
+/*!
+ * @brief Power mode constraint and resource constraints set and released together.
+ *
+ * Built with with(), each call returns a new set with one more resource.
+ *
+ * @tparam N Number of resource constraints.
+ */
+template <std::size_t N = 0U>
+class ConstraintSet
+{
+  public:
+    /*!
+     * @brief Empty set.
+     *
+     * @param powerMode Deepest power state allowed, PM_LP_STATE_NO_CONSTRAINT for none.
+     */
+    constexpr explicit ConstraintSet(uint8_t powerMode = PM_LP_STATE_NO_CONSTRAINT) noexcept
+        : m_powerMode(powerMode), m_resources{}
+    {
+        static_assert(N == 0U, "Use with() to add resources to the set.");
+    }
+
+    /*! @brief Set with the same resources and another power mode constraint. */
+    constexpr ConstraintSet withPowerMode(uint8_t powerMode) const noexcept
+    {
+        return ConstraintSet(powerMode, m_resources);
+    }
+
+    /*! @brief Set with one more resource constraint. */
+    constexpr ConstraintSet<N + 1U> with(Resource resource) const noexcept
+    {
+        std::array<uint32_t, N + 1U> resources{};
+
+        for (std::size_t i = 0U; i < N; i++)
+        {
+            resources[i] = m_resources[i];
+        }
+        resources[N] = resource.encoded();
+
+        return ConstraintSet<N + 1U>(m_powerMode, resources);
+    }
+
+    /*! @brief Set with one more resource constraint, given by its encoded value, for example PM_RESC_FRO_144M_ON. */
+    constexpr ConstraintSet<N + 1U> with(uint32_t encoded) const noexcept
+    {
+        return with(Resource::fromEncoded(encoded));
+    }
+
+    /*! @brief Set with one more resource constraint, given by the index of the resource and its operating mode. */
+    constexpr ConstraintSet<N + 1U> with(uint32_t index, OpMode mode) const noexcept
+    {
+        return with(Resource(index, mode));
+    }
+
+    /*! @brief Power mode constraint. */
+    constexpr uint8_t powerMode() const noexcept
+    {
+        return m_powerMode;
+    }
+
+    /*! @brief Number of resource constraints. */
+    static constexpr std::size_t size() noexcept
+    {
+        return N;
+    }
+
+    /*! @brief Encoded resource constraint at the given position. */
+    constexpr uint32_t resource(std::size_t i) const noexcept
+    {
+        return m_resources[i];
+    }
+
+    /*!
+     * @brief Check the power mode is a state of the device or PM_LP_STATE_NO_CONSTRAINT, and every resource is valid.
+     */
+    constexpr bool isValid() const noexcept
+    {
+        bool valid = (m_powerMode < (uint8_t)PM_LP_STATE_COUNT) || (m_powerMode == PM_LP_STATE_NO_CONSTRAINT);
+
+        for (std::size_t i = 0U; i < N; i++)
+        {
+            valid = valid && Resource::fromEncoded(m_resources[i]).isValid();
+        }
+
+        return valid;
+    }
+
+  private:
+    template <std::size_t>
+    friend class ConstraintSet;
+
+    constexpr ConstraintSet(uint8_t powerMode, const std::array<uint32_t, N> &resources) noexcept
+        : m_powerMode(powerMode), m_resources(resources)
+    {
+    }
+
+    uint8_t m_powerMode;
+    std::array<uint32_t, N> m_resources;
+};
+
+/*!
+ * @brief Scoped guard holding the constraints of a set.
+ *
+ * The constraints are set by the constructor and released by the destructor, or earlier by reset(). The guard can be
+ * moved but not copied, so the constraints are released once. PM_SetConstraints() sets the constraints all or none:
+ * if it fails the guard owns nothing and nothing is released, status() gives the error.
+ *
+ * @tparam Set constexpr pm::ConstraintSet with static storage duration, checked at compile time.
+ */
+template <const auto &Set>
+class ScopedConstraint
+{
+    static_assert(Set.isValid(), "Invalid power mode or resource constraint in the set.");
+    static_assert(Set.size() <= (std::size_t)INT32_MAX, "Too many resource constraints in the set.");
+
+  public:
+    /*!
+     * @brief Set the constraints on the default power manager instance.
+     */
+    ScopedConstraint() noexcept : m_handle(nullptr)
+    {
+        m_status = set(std::make_index_sequence<Set.size()>{});
+    }
+
+    /*!
+     * @brief Set the constraints on the power manager instance given by handle.
+     *
+     * @param handle Pointer to the power manager instance.
+     */
+    explicit ScopedConstraint(pm_handle_t *handle) noexcept : m_handle(handle)
+    {
+        m_status = set(std::make_index_sequence<Set.size()>{});
+    }
+
+    ScopedConstraint(ScopedConstraint &&other) noexcept
+        : m_handle(other.m_handle), m_status(std::exchange(other.m_status, kStatus_Fail))
+    {
+    }
+
+    ScopedConstraint &operator=(ScopedConstraint &&other) noexcept
+    {
+        if (this != &other)
+        {
+            reset();
+            m_handle = other.m_handle;
+            m_status = std::exchange(other.m_status, kStatus_Fail);
+        }
+
+        return *this;
+    }
+
+    ScopedConstraint(const ScopedConstraint &)            = delete;
+    ScopedConstraint &operator=(const ScopedConstraint &) = delete;
+
+    ~ScopedConstraint()
+    {
+        reset();
+    }
+
+    /*! @brief Release the constraints now, if owned. */
+    void reset() noexcept
+    {
+        if (m_status == kStatus_Success)
+        {
+            m_status = kStatus_Fail;
+            (void)release(std::make_index_sequence<Set.size()>{});
+        }
+    }
+
+    /*! @brief Whether the guard holds the constraints. */
+    bool owns() const noexcept
+    {
+        return m_status == kStatus_Success;
+    }
+
+    /*! @brief Status returned by PM_SetConstraints(), kStatus_Fail once released or moved from. */
+    status_t status() const noexcept
+    {
+        return m_status;
+    }
+
+  private:
+    template <std::size_t... I>
+    status_t set(std::index_sequence<I...>) const noexcept
+    {
+        return (m_handle == nullptr) ?
+                   PM_SetConstraints(Set.powerMode(), (int32_t)Set.size(), (int32_t)Set.resource(I)...) :
+                   PM_SetConstraintsByHandle(m_handle, Set.powerMode(), (int32_t)Set.size(),
+                                             (int32_t)Set.resource(I)...);
+    }
+
+    template <std::size_t... I>
+    status_t release(std::index_sequence<I...>) const noexcept
+    {
+        return (m_handle == nullptr) ?
+                   PM_ReleaseConstraints(Set.powerMode(), (int32_t)Set.size(), (int32_t)Set.resource(I)...) :
+                   PM_ReleaseConstraintsByHandle(m_handle, Set.powerMode(), (int32_t)Set.size(),
+                                                 (int32_t)Set.resource(I)...);
+    }
+
+    pm_handle_t *m_handle;
+    status_t m_status;
+};
+
+/*! @brief Set of resources, with the layout of pm_resc_mask_t. */
+class RescMask
+{
+  public:
+    /*! @brief Empty set. */
+    constexpr RescMask() noexcept : m_words{}
+    {
+    }
+
+    /*!
+     * @brief Set of the given resources.
+     *
+     * @param indexes Indexes of the resources, for example kResc_FRO_144M.
+     */
+    template <typename... Index>
+    static constexpr RescMask of(Index... indexes) noexcept
+    {
+        RescMask mask;
+        const uint32_t list[] = {0U, static_cast<uint32_t>(indexes)...};
+
+        for (std::size_t i = 1U; i < sizeof(list) / sizeof(list[0]); i++)
+        {
+            mask.m_words[list[i] / 32U] |= 1UL << (list[i] % 32U);
+        }
+
+        return mask;
+    }
+
+    /*!
+     * @brief Set given by its mask words, for example PM_MASK_RESC_LOWEST_SLEEP0 and PM_MASK_RESC_LOWEST_SLEEP1.
+     */
+    template <typename... Word>
+    static constexpr RescMask fromWords(Word... words) noexcept
+    {
+        static_assert(sizeof...(Word) <= PM_RESC_MASK_ARRAY_SIZE, "Too many words for pm_resc_mask_t.");
+        RescMask mask;
+        const uint32_t list[] = {0U, static_cast<uint32_t>(words)...};
+
+        for (std::size_t i = 1U; i < sizeof(list) / sizeof(list[0]); i++)
+        {
+            mask.m_words[i - 1U] = list[i];
+        }
+
+        return mask;
+    }
+
+    constexpr RescMask operator|(const RescMask &other) const noexcept
+    {
+        RescMask mask;
+
+        for (std::size_t i = 0U; i < PM_RESC_MASK_ARRAY_SIZE; i++)
+        {
+            mask.m_words[i] = m_words[i] | other.m_words[i];
+        }
+
+        return mask;
+    }
+
+    constexpr RescMask operator&(const RescMask &other) const noexcept
+    {
+        RescMask mask;
+
+        for (std::size_t i = 0U; i < PM_RESC_MASK_ARRAY_SIZE; i++)
+        {
+            mask.m_words[i] = m_words[i] & other.m_words[i];
+        }
+
+        return mask;
+    }
+
+    /*! @brief Complement, every word is inverted as done by the board files for fixConstraintsMask. */
+    constexpr RescMask operator~() const noexcept
+    {
+        RescMask mask;
+
+        for (std::size_t i = 0U; i < PM_RESC_MASK_ARRAY_SIZE; i++)
+        {
+            mask.m_words[i] = ~m_words[i];
+        }
+
+        return mask;
+    }
+
+    /*! @brief Whether every resource of other is in the set. */
+    constexpr bool contains(const RescMask &other) const noexcept
+    {
+        bool result = true;
+
+        for (std::size_t i = 0U; i < PM_RESC_MASK_ARRAY_SIZE; i++)
+        {
+            result = result && ((other.m_words[i] & ~m_words[i]) == 0U);
+        }
+
+        return result;
+    }
+
+    /*! @brief Whether the set only contains resources of the device, with an index below PM_CONSTRAINT_COUNT. */
+    constexpr bool isValid() const noexcept
+    {
+        bool valid = true;
+
+        for (std::size_t i = 0U; i < PM_RESC_MASK_ARRAY_SIZE; i++)
+        {
+            for (std::size_t bit = 0U; bit < 32U; bit++)
+            {
+                valid = valid && ((((m_words[i] >> bit) & 1UL) == 0U) ||
+                                  ((i * 32U + bit) < (std::size_t)PM_CONSTRAINT_COUNT));
+            }
+        }
+
+        return valid;
+    }
+
+    /*! @brief Set in the layout of the C API. */
+    constexpr pm_resc_mask_t toC() const noexcept
+    {
+        pm_resc_mask_t mask{};
+
+        for (std::size_t i = 0U; i < PM_RESC_MASK_ARRAY_SIZE; i++)
+        {
+            mask.rescMask[i] = m_words[i];
+        }
+
+        return mask;
+    }
+
+  private:
+    uint32_t m_words[PM_RESC_MASK_ARRAY_SIZE];
+};
+
+/*! @brief Power state description, the constexpr counterpart of pm_state_t. */
+struct State
+{
+    uint32_t exitLatency;  /*!< The latency that the power state need to exit, in us. */
+    RescMask available;    /*!< Resources that can stay on in the power state, the other ones are lost. */
+    RescMask configurable; /*!< Resources whose state can be configured, only the available ones are kept. */
+#if (defined(FSL_PM_SUPPORT_GOVERNOR) && FSL_PM_SUPPORT_GOVERNOR)
+    uint32_t breakEvenTime = 0U; /*!< Shortest residency for which the power state saves energy, 0 means
+                                      exitLatency. */
+#endif                           /* FSL_PM_SUPPORT_GOVERNOR */
+
+    /*! @brief Power state in the layout of the C API. */
+    constexpr pm_state_t toC() const noexcept
+    {
+        pm_state_t state{};
+
+        state.exitLatency        = exitLatency;
+        state.fixConstraintsMask = (~available).toC();
+        state.varConstraintsMask = (available & configurable).toC();
+#if (defined(FSL_PM_SUPPORT_GOVERNOR) && FSL_PM_SUPPORT_GOVERNOR)
+        state.breakEvenTime = breakEvenTime;
+#endif /* FSL_PM_SUPPORT_GOVERNOR */
+
+        return state;
+    }
+};
+
+/*!
+ * @brief Check a power state table: it fits in pm_device_option_t, the available masks only contain resources of the
+ * device, and the states are ordered in decreasing power consumption, i.e. the exit latency does not decrease and a
+ * state does not keep a resource that the previous state loses.
+ */
+template <std::size_t N>
+constexpr bool isValidStateTable(const std::array<State, N> &states) noexcept
+{
+    bool valid = (N > 0U) && (N <= (std::size_t)PM_LP_STATE_COUNT);
+
+    for (std::size_t i = 0U; i < N; i++)
+    {
+        valid = valid && states[i].available.isValid();
+        if (i > 0U)
+        {
+            valid = valid && (states[i].exitLatency >= states[i - 1U].exitLatency) &&
+                    states[i - 1U].available.contains(states[i].available);
+        }
+    }
+
+    return valid;
+}
+
+/*!
+ * @brief Build the device option of a checked power state table, to be given to PM_InitHandle().
+ *
+ * @code
+ * constexpr auto kConfigurable = pm::RescMask::fromWords(PM_MASK_RESC_NOT_VAR0, PM_MASK_RESC_NOT_VAR1);
+ * constexpr std::array<pm::State, 2U> kStates = {{
+ *     {14U, pm::RescMask::fromWords(PM_MASK_RESC_LOWEST_SLEEP0, PM_MASK_RESC_LOWEST_SLEEP1), kConfigurable},
+ *     {600U, pm::RescMask::fromWords(PM_MASK_RESC_LOWEST_PDDS0, PM_MASK_RESC_LOWEST_PDDS1), kConfigurable},
+ * }};
+ * static pm_device_option_t s_deviceOption = pm::makeDeviceOption<kStates>(APP_EnterLowPower, APP_CleanExit);
+ * @endcode
+ *
+ * The functions of the device that the enabled features call are parameters too, in the order of pm_device_option_t:
+ * with FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER, makeDeviceOption<kStates>(APP_EnterLowPower, APP_CleanExit,
+ * APP_ManageWakeupSource, APP_IsWakeupSource).
+ *
+ * @tparam States constexpr std::array of pm::State with static storage duration, checked at compile time.
+ * @param enter Function entering the power state, see pm_device_option_t.
+ * @param clean Function called after the exit of the power state, see pm_device_option_t.
+ * @param manageWakeupSource Function enabling or disabling a wakeup source, with FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER.
+ * @param isWakeupSource Function telling if a wakeup source triggered the last wakeup, with
+ *                       FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER.
+ * @param rescDependency Prerequisites of the resources, with FSL_PM_SUPPORT_RESOURCE_DEPENDENCY, nullptr for none.
+ */
+template <const auto &States>
+constexpr pm_device_option_t makeDeviceOption(void (*enter)(uint8_t, pm_resc_mask_t *, pm_resc_group_t *),
+                                              void (*clean)(void)
+#if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
+                                                  ,
+                                              status_t (*manageWakeupSource)(pm_wakeup_source_t *, bool),
+                                              bool (*isWakeupSource)(pm_wakeup_source_t *)
+#endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
+#if (defined(FSL_PM_SUPPORT_RESOURCE_DEPENDENCY) && FSL_PM_SUPPORT_RESOURCE_DEPENDENCY)
+                                                  ,
+                                              const pm_resc_mask_t *rescDependency
+#endif /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
+                                              ) noexcept
+{
+    static_assert(isValidStateTable(States), "Invalid power state table, or states not ordered by power.");
+    pm_device_option_t option{};
+
+    for (std::size_t i = 0U; i < States.size(); i++)
+    {
+        option.states[i] = States[i].toC();
+    }
+    option.stateCount = (uint8_t)States.size();
+    option.enter      = enter;
+    option.clean      = clean;
+#if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
+    option.manageWakeupSource = manageWakeupSource;
+    option.isWakeupSource     = isWakeupSource;
+#endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
+#if (defined(FSL_PM_SUPPORT_RESOURCE_DEPENDENCY) && FSL_PM_SUPPORT_RESOURCE_DEPENDENCY)
+    option.rescDependency = rescDependency;
+#endif /* FSL_PM_SUPPORT_RESOURCE_DEPENDENCY */
+
+    return option;
+}
+
+#if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
+/*!
+ * @brief Wakeup source id, as encoded by PM_ENCODE_WAKEUP_SOURCE_ID(), for example PM_WSID_LPTMR0.
+ *
+ * Keeps wakeup source ids apart from resource constraints and other integers.
+ */
+class WakeupSourceId
+{
+  public:
+    constexpr explicit WakeupSourceId(uint32_t id) noexcept : m_id(id)
+    {
+    }
+
+    /*! @brief Encoded value, as stored in pm_wakeup_source_t. */
+    constexpr uint32_t value() const noexcept
+    {
+        return m_id;
+    }
+
+  private:
+    uint32_t m_id;
+};
+
+/*!
+ * @brief Same as PM_InitWakeupSource(), with a typed wakeup source id.
+ */
+inline void initWakeupSource(pm_wakeup_source_t *ws,
+                             WakeupSourceId id,
+                             pm_wake_up_source_service_func_t service,
+                             bool enable) noexcept
+{
+    PM_InitWakeupSource(ws, id.value(), service, enable);
+}
+
+/*!
+ * @brief Same as PM_InitWakeupSourceByHandle(), with a typed wakeup source id.
+ */
+inline void initWakeupSource(pm_handle_t *handle,
+                             pm_wakeup_source_t *ws,
+                             WakeupSourceId id,
+                             pm_wake_up_source_service_func_t service,
+                             bool enable) noexcept
+{
+    PM_InitWakeupSourceByHandle(handle, ws, id.value(), service, enable);
+}
+#endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
+} /* namespace pm */
+
+/*! @} */
+
+/*! @} */
+
+#endif /* _FSL_PM_HPP_ */
@@ -0,0 +1,292 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_pm_event_loop.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+typedef struct _pm_event_loop
+{
+    pm_event_task_t *tasks[PM_EVENT_LOOP_PRIORITY_COUNT];
+    volatile uint32_t readyTasks; /*!< Bit n is set when the task of priority n may have a pending event. */
+} pm_event_loop_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static bool PM_EventQueueReserve(pm_event_task_t *task, uint32_t *position);
+static bool PM_EventQueueIsEmpty(const pm_event_task_t *task);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static pm_event_loop_t s_pmEventLoop;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Reserve a slot of the task queue for a producer.
+ *
+ * A slot is free when its sequence number equals the position, a smaller number means that the loop did not read the
+ * event of the previous turn yet: the queue is full. A larger number means that another producer took the position
+ * in the meantime, the reservation is tried again with the next one.
+ */
+static bool PM_EventQueueReserve(pm_event_task_t *task, uint32_t *position)
+{
+    uint32_t pos;
+    int32_t diff;
+
+/* clang-format off */
+#if ((defined(__ARM_ARCH_7M__     ) && (__ARM_ARCH_7M__      == 1)) || \
+     (defined(__ARM_ARCH_7EM__    ) && (__ARM_ARCH_7EM__     == 1)) || \
+     (defined(__ARM_ARCH_8M_MAIN__) && (__ARM_ARCH_8M_MAIN__ == 1)) || \
+     (defined(__ARM_ARCH_8M_BASE__) && (__ARM_ARCH_8M_BASE__ == 1)))
+    /* clang-format on */
+    do
+    {
+        pos  = __LDREXW(&task->enqueuePos);
+        diff = (int32_t)(task->slots[pos & task->mask].sequence - pos);
+        if (diff != 0)
+        {
+            __CLREX();
+            if (diff < 0)
+            {
+                break;
+            }
+        }
+        else if (__STREXW(pos + 1U, &task->enqueuePos) != 0U)
+        {
+            /* Preempted by another producer, try again. */
+            diff = 1;
+        }
+        else
+        {
+            /* Reserved. */
+        }
+    } while (diff != 0);
+#else
+    uint32_t regPrimask;
+
+    regPrimask = DisableGlobalIRQ();
+    pos        = task->enqueuePos;
+    diff       = (int32_t)(task->slots[pos & task->mask].sequence - pos);
+    if (diff == 0)
+    {
+        task->enqueuePos = pos + 1U;
+    }
+    EnableGlobalIRQ(regPrimask);
+#endif
+
+    *position = pos;
+
+    return (diff == 0);
+}
+
+static bool PM_EventQueueIsEmpty(const pm_event_task_t *task)
+{
+    return (task->slots[task->dequeuePos & task->mask].sequence != (task->dequeuePos + 1U));
+}
+
+/*!
+ * brief Initialize the event loop, no task is registered.
+ */
+void PM_EventLoopInit(void)
+{
+    (void)memset(&s_pmEventLoop, 0, sizeof(s_pmEventLoop));
+}
+
+/*!
+ * brief Initialize a task and register it to the event loop.
+ *
+ * param task Pointer to the task.
+ * param priority Priority of the task, from 0 (lowest) to PM_EVENT_LOOP_PRIORITY_COUNT - 1 (highest).
+ * param handler Event handler of the task.
+ * param context Parameter passed to the handler.
+ * param slots Event queue of the task.
+ * param slotCount Number of slots, a power of 2.
+ * retval kStatus_PMSuccess The task is registered.
+ * retval kStatus_PMFail The priority is out of range or already used, or slotCount is not a power of 2.
+ */
+status_t PM_EventTaskInit(pm_event_task_t *task,
+                          uint8_t priority,
+                          pm_event_handler_t handler,
+                          void *context,
+                          pm_event_slot_t *slots,
+                          uint32_t slotCount)
+{
+    status_t status = kStatus_PMSuccess;
+    uint32_t index;
+
+    assert(task != NULL);
+    assert(handler != NULL);
+    assert(slots != NULL);
+
+    if ((priority >= PM_EVENT_LOOP_PRIORITY_COUNT) || (s_pmEventLoop.tasks[priority] != NULL) || (slotCount == 0U) ||
+        ((slotCount & (slotCount - 1U)) != 0U))
+    {
+        status = kStatus_PMFail;
+    }
+    else
+    {
+        (void)memset(task, 0, sizeof(*task));
+        task->handler  = handler;
+        task->context  = context;
+        task->slots    = slots;
+        task->mask     = slotCount - 1U;
+        task->priority = priority;
+        for (index = 0U; index < slotCount; index++)
+        {
+            slots[index].sequence = index;
+        }
+
+        s_pmEventLoop.tasks[priority] = task;
+    }
+
+    return status;
+}
+
+/*!
+ * brief Post an event to a task.
+ *
+ * Can be called from thread and interrupt context, the interrupts are not masked.
+ *
+ * param task Pointer to the task.
+ * param signal Event identifier.
+ * param param Event parameter.
+ * retval kStatus_PMSuccess The event is queued.
+ * retval kStatus_PMEventQueueFull The queue of the task is full, the event is dropped and counted.
+ */
+status_t PM_EventPost(pm_event_task_t *task, uint32_t signal, void *param)
+{
+    status_t status = kStatus_PMSuccess;
+    pm_event_slot_t *slot;
+    uint32_t pos;
+
+    assert(task != NULL);
+
+    if (PM_EventQueueReserve(task, &pos))
+    {
+        slot               = &task->slots[pos & task->mask];
+        slot->event.signal = signal;
+        slot->event.param  = param;
+        /* The event is written before it is published. */
+        __DMB();
+        slot->sequence = pos + 1U;
+        SDK_ATOMIC_LOCAL_SET(&s_pmEventLoop.readyTasks, 1UL << task->priority);
+    }
+    else
+    {
+        SDK_ATOMIC_LOCAL_ADD(&task->droppedCount, 1U);
+        status = kStatus_PMEventQueueFull;
+    }
+
+    return status;
+}
+
+/*!
+ * brief Call the handler of the highest priority task for its oldest event.
+ *
+ * return true if an event was handled, false if no event is pending.
+ */
+bool PM_EventLoopDispatch(void)
+{
+    uint32_t readyTasks = s_pmEventLoop.readyTasks;
+    uint32_t priority;
+    pm_event_task_t *task;
+    pm_event_slot_t *slot;
+    pm_event_t event;
+    bool dispatched = false;
+
+    while ((readyTasks != 0U) && !dispatched)
+    {
+        priority = 31U - __CLZ(readyTasks);
+        task     = s_pmEventLoop.tasks[priority];
+
+        if (!PM_EventQueueIsEmpty(task))
+        {
+            slot  = &task->slots[task->dequeuePos & task->mask];
+            event = slot->event;
+            /* The slot is released before the handler runs, which may post to its own task. */
+            __DMB();
+            slot->sequence = task->dequeuePos + task->mask + 1U;
+            task->dequeuePos++;
+
+            task->handler(&event, task->context);
+            dispatched = true;
+        }
+
+        if (PM_EventQueueIsEmpty(task))
+        {
+            /* An event published after the check above sets the bit again, check once more after clearing it. */
+            SDK_ATOMIC_LOCAL_CLEAR(&s_pmEventLoop.readyTasks, 1UL << priority);
+            if (!PM_EventQueueIsEmpty(task))
+            {
+                SDK_ATOMIC_LOCAL_SET(&s_pmEventLoop.readyTasks, 1UL << priority);
+            }
+        }
+
+        readyTasks &= ~(1UL << priority);
+    }
+
+    return dispatched;
+}
+
+/*!
+ * brief Idle hook of the event loop.
+ *
+ * Processes the expired software timers, then enters the deepest allowed low power state until the next timer if
+ * no event is pending. The check and the low power entry are done with the interrupts masked, an event posted in
+ * between wakes the device up at once.
+ */
+void PM_EventLoopIdle(void)
+{
+    uint32_t regPrimask;
+    uint64_t wakeTime;
+    uint64_t now;
+
+    /* The timer callbacks may post events. */
+    PM_TimerServiceProcess();
+
+    regPrimask = DisableGlobalIRQ();
+    if (s_pmEventLoop.readyTasks == 0U)
+    {
+        wakeTime = PM_TimerServiceGetNextExpiry();
+        now      = PM_TimerServiceGetTime();
+        if (wakeTime == PM_TIMER_SERVICE_NO_EXPIRY)
+        {
+            PM_EnterLowPower(0U);
+        }
+        else if (wakeTime > now)
+        {
+            PM_EnterLowPower(wakeTime - now);
+        }
+        else
+        {
+            /* A timer expired in the meantime, it is processed by the next call. */
+        }
+    }
+    /* The interrupt that woke up the device is served here. */
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Run the event loop, never returns.
+ */
+void PM_EventLoopRun(void)
+{
+    for (;;)
+    {
+        if (!PM_EventLoopDispatch())
+        {
+            PM_EventLoopIdle();
+        }
+    }
+}
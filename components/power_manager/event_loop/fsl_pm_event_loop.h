@@ -0,0 +1,169 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_PM_EVENT_LOOP_H_
+#define _FSL_PM_EVENT_LOOP_H_
+
+#include "fsl_common.h"
+#include "fsl_pm_core.h"
+#include "fsl_pm_timer_service.h"
+
+/*!
+ * @addtogroup PM Framework: Power Manager Framework
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @name Event loop
+ *
+ * Run-to-completion event loop for bare-metal applications. Each task owns a queue of events and a priority, the
+ * loop calls the handler of the highest priority task with a pending event, one event at a time. Events are posted
+ * from thread or interrupt context without masking the interrupts. When no event is pending, the loop enters the
+ * deepest allowed low power state until the next software timer of the timer service:
+ * @code
+ * static pm_event_slot_t s_sensorSlots[8];
+ * static pm_event_task_t s_sensorTask;
+ *
+ * PM_TimerServiceInit(&s_timerPort);
+ * PM_EventLoopInit();
+ * PM_EventTaskInit(&s_sensorTask, 3U, APP_SensorHandler, NULL, s_sensorSlots, ARRAY_SIZE(s_sensorSlots));
+ * PM_EventLoopRun();
+ *
+ * void APP_SensorIRQHandler(void)
+ * {
+ *     (void)PM_EventPost(&s_sensorTask, APP_SIGNAL_DATA_READY, NULL);
+ * }
+ * @endcode
+ * The timer service must be initialized before the loop runs, software timer callbacks typically post events.
+ * @{
+ */
+
+/*! @brief Number of task priorities, each priority is used by one task at most. */
+#define PM_EVENT_LOOP_PRIORITY_COUNT (32U)
+
+/*! @} */
+
+/*!
+ * @brief Event posted to a task.
+ */
+typedef struct _pm_event
+{
+    uint32_t signal; /*!< Application defined event identifier. */
+    void *param;     /*!< Application defined event parameter. */
+} pm_event_t;
+
+/*!
+ * @brief Slot of a task event queue.
+ *
+ * The sequence number tells producers and consumer whether the slot is free or holds an event, the queue is
+ * lock-free.
+ */
+typedef struct _pm_event_slot
+{
+    volatile uint32_t sequence;
+    pm_event_t event;
+} pm_event_slot_t;
+
+/*!
+ * @brief Event handler of a task, runs to completion.
+ */
+typedef void (*pm_event_handler_t)(const pm_event_t *event, void *context);
+
+/*!
+ * @brief Event loop task, the memory is provided by the application.
+ */
+typedef struct _pm_event_task
+{
+    pm_event_handler_t handler;
+    void *context;
+    pm_event_slot_t *slots;
+    uint32_t mask;                  /*!< Number of slots minus 1. */
+    volatile uint32_t enqueuePos;   /*!< Next position reserved by a producer. */
+    uint32_t dequeuePos;            /*!< Next position read by the loop. */
+    volatile uint32_t droppedCount; /*!< Number of events lost because the queue was full. */
+    uint8_t priority;
+} pm_event_task_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initialize the event loop, no task is registered.
+ */
+void PM_EventLoopInit(void);
+
+/*!
+ * @brief Initialize a task and register it to the event loop.
+ *
+ * @param task Pointer to the task.
+ * @param priority Priority of the task, from 0 (lowest) to PM_EVENT_LOOP_PRIORITY_COUNT - 1 (highest).
+ * @param handler Event handler of the task.
+ * @param context Parameter passed to the handler.
+ * @param slots Event queue of the task.
+ * @param slotCount Number of slots, a power of 2.
+ * @retval kStatus_PMSuccess The task is registered.
+ * @retval kStatus_PMFail The priority is out of range or already used, or slotCount is not a power of 2.
+ */
+status_t PM_EventTaskInit(pm_event_task_t *task,
+                          uint8_t priority,
+                          pm_event_handler_t handler,
+                          void *context,
+                          pm_event_slot_t *slots,
+                          uint32_t slotCount);
+
+/*!
+ * @brief Post an event to a task.
+ *
+ * Can be called from thread and interrupt context, the interrupts are not masked.
+ *
+ * @param task Pointer to the task.
+ * @param signal Event identifier.
+ * @param param Event parameter.
+ * @retval kStatus_PMSuccess The event is queued.
+ * @retval kStatus_PMEventQueueFull The queue of the task is full, the event is dropped and counted.
+ */
+status_t PM_EventPost(pm_event_task_t *task, uint32_t signal, void *param);
+
+/*!
+ * @brief Call the handler of the highest priority task for its oldest event.
+ *
+ * @return true if an event was handled, false if no event is pending.
+ */
+bool PM_EventLoopDispatch(void);
+
+/*!
+ * @brief Idle hook of the event loop.
+ *
+ * Processes the expired software timers, then enters the deepest allowed low power state until the next timer if
+ * no event is pending. The check and the low power entry are done with the interrupts masked, an event posted in
+ * between wakes the device up at once.
+ */
+void PM_EventLoopIdle(void);
+
+/*!
+ * @brief Run the event loop, never returns.
+ */
+void PM_EventLoopRun(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*!
+ * @}
+ */
+
+#endif /* _FSL_PM_EVENT_LOOP_H_ */
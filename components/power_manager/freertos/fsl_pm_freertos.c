@@ -0,0 +1,213 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_pm_freertos.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#ifndef configSYSTICK_CLOCK_HZ
+#define configSYSTICK_CLOCK_HZ configCPU_CLOCK_HZ
+#endif /* configSYSTICK_CLOCK_HZ */
+
+#define PM_FREERTOS_US_PER_SECOND (1000000ULL)
+
+/*
+ * Interrupt masking around the low power entry. PRIMASK by default, the masked interrupts still wake up the core. Can
+ * be defined in FreeRTOSConfig.h for the ports without PRIMASK, such as the POSIX port where the interrupts are
+ * signals.
+ */
+#ifndef PM_FREERTOS_DISABLE_IRQ
+#define PM_FREERTOS_DISABLE_IRQ() DisableGlobalIRQ()
+#endif /* PM_FREERTOS_DISABLE_IRQ */
+
+#ifndef PM_FREERTOS_ENABLE_IRQ
+#define PM_FREERTOS_ENABLE_IRQ(primask) EnableGlobalIRQ(primask)
+#endif /* PM_FREERTOS_ENABLE_IRQ */
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static void PM_FreeRTOSEnterLowPower(uint64_t entryTimestamp, uint64_t idleTime);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static const pm_freertos_tickless_config_t *s_pmTicklessConfig;
+static uint32_t s_pmSuppressedTicks;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Call the power manager for the idle time, 0 if no task waits for a timeout.
+ */
+static void PM_FreeRTOSEnterLowPower(uint64_t entryTimestamp, uint64_t idleTime)
+{
+#if (defined(FSL_PM_SUPPORT_DEADLINE) && FSL_PM_SUPPORT_DEADLINE)
+    if (idleTime != 0U)
+    {
+        (void)PM_EnterLowPowerUntil(entryTimestamp + s_pmTicklessConfig->usToTimestamp(idleTime));
+    }
+    else
+#else
+    (void)entryTimestamp;
+#endif /* FSL_PM_SUPPORT_DEADLINE */
+    {
+#if (defined(FSL_PM_SUPPORT_TIME_BASE) && FSL_PM_SUPPORT_TIME_BASE)
+        PM_EnterLowPower(PM_UsToTicks(idleTime));
+#else
+        PM_EnterLowPower(idleTime);
+#endif /* FSL_PM_SUPPORT_TIME_BASE */
+    }
+}
+
+/*!
+ * brief Initialize the tickless idle.
+ *
+ * To be called before the scheduler is started, after the power manager is initialized.
+ *
+ * param config The tick and timestamp functions, must stay valid while the scheduler runs.
+ */
+void PM_FreeRTOSInitTickless(const pm_freertos_tickless_config_t *config)
+{
+    assert(config != NULL);
+    assert((config->stopTick != NULL) && (config->startTick != NULL));
+    assert((config->getTimestamp != NULL) && (config->getDuration != NULL));
+#if (defined(FSL_PM_SUPPORT_DEADLINE) && FSL_PM_SUPPORT_DEADLINE)
+    assert(config->usToTimestamp != NULL);
+#endif /* FSL_PM_SUPPORT_DEADLINE */
+
+    s_pmTicklessConfig  = config;
+    s_pmSuppressedTicks = 0U;
+}
+
+/*!
+ * brief Stop the kernel tick and enter the low power mode until the next task unblocks.
+ *
+ * Called by the kernel from the idle task with the scheduler suspended. The time spent with the tick stopped is
+ * measured with the timestamps, the whole ticks are added to the tick count and the remainder sets the phase of the
+ * next tick.
+ *
+ * param expectedIdleTime Number of ticks until the next task unblocks, portMAX_DELAY if no task waits for a timeout.
+ */
+void PM_FreeRTOSSuppressTicksAndSleep(TickType_t expectedIdleTime)
+{
+    uint32_t regPrimask;
+    uint64_t entryTimestamp;
+    uint64_t sinceTick;
+    uint64_t idleTime = 0U;
+    uint64_t ticks;
+    eSleepModeStatus sleepStatus;
+
+    assert(s_pmTicklessConfig != NULL);
+
+    /* Interrupts masked by PRIMASK still wake up the core, they are served once the tick is restarted. */
+    regPrimask  = PM_FREERTOS_DISABLE_IRQ();
+    sleepStatus = eTaskConfirmSleepModeStatus();
+    if (sleepStatus != eAbortSleep)
+    {
+        sinceTick      = (uint64_t)s_pmTicklessConfig->stopTick();
+        entryTimestamp = s_pmTicklessConfig->getTimestamp();
+
+        if (sleepStatus != eNoTasksWaitingTimeout)
+        {
+            idleTime = (uint64_t)expectedIdleTime * PM_FREERTOS_TICK_US;
+            idleTime = (idleTime > sinceTick) ? (idleTime - sinceTick) : 0U;
+        }
+
+        if ((idleTime != 0U) || (sleepStatus == eNoTasksWaitingTimeout))
+        {
+            PM_FreeRTOSEnterLowPower(entryTimestamp, idleTime);
+        }
+
+        sinceTick += s_pmTicklessConfig->getDuration(entryTimestamp, s_pmTicklessConfig->getTimestamp());
+
+        /*
+         * The tick interrupt counts the tick at which the task unblocks, at most expectedIdleTime - 1 ticks are added
+         * here and the next tick is then due at once.
+         */
+        ticks = sinceTick / PM_FREERTOS_TICK_US;
+        if ((sleepStatus != eNoTasksWaitingTimeout) && (ticks >= (uint64_t)expectedIdleTime))
+        {
+            ticks     = (uint64_t)expectedIdleTime - 1U;
+            sinceTick = (ticks * PM_FREERTOS_TICK_US) + PM_FREERTOS_TICK_US - 1U;
+        }
+
+        if (ticks != 0U)
+        {
+            vTaskStepTick((TickType_t)ticks);
+            s_pmSuppressedTicks += (uint32_t)ticks;
+        }
+        s_pmTicklessConfig->startTick(PM_FREERTOS_TICK_US - (uint32_t)(sinceTick % PM_FREERTOS_TICK_US));
+    }
+    PM_FREERTOS_ENABLE_IRQ(regPrimask);
+}
+
+/*!
+ * brief Get the number of ticks added to the tick count since the tickless idle was initialized.
+ *
+ * return The number of ticks the tick interrupt was suppressed for.
+ */
+uint32_t PM_FreeRTOSGetSuppressedTicks(void)
+{
+    return s_pmSuppressedTicks;
+}
+
+#if (defined(configUSE_TICKLESS_IDLE) && (configUSE_TICKLESS_IDLE == 1))
+/* Replaces the default implementation of the port. */
+void vPortSuppressTicksAndSleep(TickType_t xExpectedIdleTime)
+{
+    PM_FreeRTOSSuppressTicksAndSleep(xExpectedIdleTime);
+}
+#endif /* configUSE_TICKLESS_IDLE */
+
+#if defined(SysTick)
+/*!
+ * brief Stop the SysTick used as kernel tick.
+ *
+ * Matches the stopTick function of pm_freertos_tickless_config_t.
+ *
+ * return The time elapsed since the last counted tick in microseconds.
+ */
+uint32_t PM_FreeRTOSStopSysTick(void)
+{
+    uint32_t cycles;
+
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+    cycles = SysTick->LOAD - SysTick->VAL;
+
+    /* The counter wrapped and the tick interrupt is pending, the adapter counts that tick instead. */
+    if ((SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) != 0U)
+    {
+        SCB->ICSR = SCB_ICSR_PENDSTCLR_Msk;
+        cycles += SysTick->LOAD + 1U;
+    }
+
+    return (uint32_t)(((uint64_t)cycles * PM_FREERTOS_US_PER_SECOND) / (uint64_t)configSYSTICK_CLOCK_HZ);
+}
+
+/*!
+ * brief Restart the SysTick used as kernel tick.
+ *
+ * Matches the startTick function of pm_freertos_tickless_config_t.
+ *
+ * param firstPeriod Time until the first tick in microseconds.
+ */
+void PM_FreeRTOSStartSysTick(uint32_t firstPeriod)
+{
+    uint32_t cycles = (uint32_t)(((uint64_t)firstPeriod * (uint64_t)configSYSTICK_CLOCK_HZ) / PM_FREERTOS_US_PER_SECOND);
+
+    SysTick->LOAD = MAX(cycles, 2U) - 1U;
+    SysTick->VAL  = 0U;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    /* The counter already loaded the first period, the next reloads use the tick period. */
+    SysTick->LOAD = ((uint32_t)configSYSTICK_CLOCK_HZ / (uint32_t)configTICK_RATE_HZ) - 1U;
+}
+#endif /* SysTick */
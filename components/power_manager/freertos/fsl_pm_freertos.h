@@ -0,0 +1,150 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_PM_FREERTOS_H_
+#define _FSL_PM_FREERTOS_H_
+
+#include "fsl_common.h"
+#include "fsl_pm_core.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*!
+ * @addtogroup PM Framework: Power Manager Framework
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @name FreeRTOS tickless idle
+ *
+ * Tickless idle of the FreeRTOS kernel built on the power manager. When the kernel is idle, the tick interrupt is
+ * stopped and the power manager enters the deepest allowed low power state until the next task unblocks. On wakeup,
+ * the tick count is compensated with the measured idle time and the tick interrupt restarts in phase.
+ *
+ * In FreeRTOSConfig.h:
+ * @code
+ * #define configUSE_TICKLESS_IDLE 1
+ * @endcode
+ * vPortSuppressTicksAndSleep() is then provided by this adapter. With ports that do not support tickless idle, such as
+ * the POSIX port:
+ * @code
+ * #define configUSE_TICKLESS_IDLE 2
+ * #define portSUPPRESS_TICKS_AND_SLEEP(expectedIdleTime) PM_FreeRTOSSuppressTicksAndSleep(expectedIdleTime)
+ * @endcode
+ * The interrupts are masked around the low power entry with DisableGlobalIRQ(). Ports without PRIMASK define the
+ * masking in FreeRTOSConfig.h, for the POSIX port:
+ * @code
+ * #define PM_FREERTOS_DISABLE_IRQ()       (portDISABLE_INTERRUPTS(), 0U)
+ * #define PM_FREERTOS_ENABLE_IRQ(primask) portENABLE_INTERRUPTS()
+ * @endcode
+ * The tick and the timestamps are described by a pm_freertos_tickless_config_t:
+ * @code
+ * static const pm_freertos_tickless_config_t s_ticklessConfig = {
+ *     .stopTick      = PM_FreeRTOSStopSysTick,
+ *     .startTick     = PM_FreeRTOSStartSysTick,
+ *     .getTimestamp  = PM_OstimerGetTimestamp,
+ *     .getDuration   = PM_OstimerGetDuration,
+ *     .usToTimestamp = PM_OstimerUsToTicks,
+ * };
+ *
+ * PM_FreeRTOSInitTickless(&s_ticklessConfig);
+ * @endcode
+ * When FSL_PM_SUPPORT_DEADLINE is enabled, the power manager is called with PM_EnterLowPowerUntil() and the unblock
+ * time of the kernel as deadline, otherwise with PM_EnterLowPower() and the duration left until that time.
+ * @{
+ */
+
+/*! @brief Duration of a kernel tick in microseconds. */
+#define PM_FREERTOS_TICK_US (1000000UL / (uint32_t)configTICK_RATE_HZ)
+
+/*! @} */
+
+/*!
+ * @brief Tick interrupt and timestamps used by the tickless idle.
+ */
+typedef struct _pm_freertos_tickless_config
+{
+    uint32_t (*stopTick)(void); /*!< Stop the tick interrupt, return the time elapsed since the last counted tick in
+                                     microseconds. A tick pending at that time must be cleared and included. */
+    void (*startTick)(uint32_t firstPeriod); /*!< Restart the tick interrupt, the first tick after firstPeriod
+                                                  microseconds and the next ones every tick period. */
+    uint64_t (*getTimestamp)(void);          /*!< Timestamp of a timer running in the low power states. */
+    uint64_t (*getDuration)(uint64_t entryTimestamp,
+                            uint64_t exitTimestamp); /*!< Microseconds elapsed between two timestamps. */
+    uint64_t (*usToTimestamp)(uint64_t us); /*!< Convert microseconds to timestamp ticks, used with
+                                                 FSL_PM_SUPPORT_DEADLINE. */
+} pm_freertos_tickless_config_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initialize the tickless idle.
+ *
+ * To be called before the scheduler is started, after the power manager is initialized.
+ *
+ * @param config The tick and timestamp functions, must stay valid while the scheduler runs.
+ */
+void PM_FreeRTOSInitTickless(const pm_freertos_tickless_config_t *config);
+
+/*!
+ * @brief Stop the kernel tick and enter the low power mode until the next task unblocks.
+ *
+ * Called by the kernel from the idle task with the scheduler suspended. The time spent with the tick stopped is
+ * measured with the timestamps, the whole ticks are added to the tick count and the remainder sets the phase of the
+ * next tick.
+ *
+ * @param expectedIdleTime Number of ticks until the next task unblocks, portMAX_DELAY if no task waits for a timeout.
+ */
+void PM_FreeRTOSSuppressTicksAndSleep(TickType_t expectedIdleTime);
+
+/*!
+ * @brief Get the number of ticks added to the tick count since the tickless idle was initialized.
+ *
+ * @return The number of ticks the tick interrupt was suppressed for.
+ */
+uint32_t PM_FreeRTOSGetSuppressedTicks(void);
+
+#if defined(SysTick)
+/*!
+ * @brief Stop the SysTick used as kernel tick.
+ *
+ * Matches the stopTick function of pm_freertos_tickless_config_t.
+ *
+ * @return The time elapsed since the last counted tick in microseconds.
+ */
+uint32_t PM_FreeRTOSStopSysTick(void);
+
+/*!
+ * @brief Restart the SysTick used as kernel tick.
+ *
+ * Matches the startTick function of pm_freertos_tickless_config_t.
+ *
+ * @param firstPeriod Time until the first tick in microseconds.
+ */
+void PM_FreeRTOSStartSysTick(uint32_t firstPeriod);
+#endif /* SysTick */
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*!
+ * @}
+ */
+
+#endif /* _FSL_PM_FREERTOS_H_ */
@@ -0,0 +1,560 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_pm_multicore.h"
+
+#if (defined(FSL_FEATURE_SOC_MAILBOX_COUNT) && FSL_FEATURE_SOC_MAILBOX_COUNT)
+#include "fsl_mailbox.h"
+#endif /* FSL_FEATURE_SOC_MAILBOX_COUNT */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define PM_MULTICORE_OWN_VOTE(mcHandle)  (&(mcHandle)->config->shared->votes[(mcHandle)->config->coreId])
+#define PM_MULTICORE_PEER_VOTE(mcHandle) (&(mcHandle)->config->shared->votes[(mcHandle)->config->coreId ^ 1U])
+
+#define PM_MULTICORE_QUEUE_SLOT(config, position) \
+    ((void *)&(config)->slots[((position) & ((config)->slotCount - 1U)) * (config)->slotSize])
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint32_t PM_MulticoreReadVote(const pm_multicore_vote_t *vote,
+                                     uint8_t *powerModeConstraint,
+                                     pm_resc_group_t *rescGroup);
+static bool PM_MulticoreRescGroupCovers(const pm_resc_group_t *group, const pm_resc_group_t *subGroup);
+static void PM_MulticoreApplyPeerVote(pm_multicore_handle_t *mcHandle, bool apply);
+static void PM_MulticoreHoldQueueConstraints(pm_multicore_handle_t *mcHandle, bool hold);
+static void PM_MulticoreQueueNotify(pm_multicore_queue_t *queue);
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Read a consistent copy of a vote, the one being written by the other core is read again.
+ */
+static uint32_t PM_MulticoreReadVote(const pm_multicore_vote_t *vote,
+                                     uint8_t *powerModeConstraint,
+                                     pm_resc_group_t *rescGroup)
+{
+    uint32_t sequence;
+
+    do
+    {
+        sequence = vote->sequence;
+        __DMB();
+        *powerModeConstraint = vote->powerModeConstraint;
+        *rescGroup           = vote->rescGroup;
+        __DMB();
+    } while (((sequence & 1U) != 0U) || (sequence != vote->sequence));
+
+    return sequence;
+}
+
+/*!
+ * @brief Check that every operating mode requested in subGroup is also requested in group.
+ */
+static bool PM_MulticoreRescGroupCovers(const pm_resc_group_t *group, const pm_resc_group_t *subGroup)
+{
+    uint32_t i;
+    bool covers = true;
+
+    for (i = 0U; i < (uint32_t)PM_RESC_GROUP_ARRAY_SIZE; i++)
+    {
+        if ((subGroup->groupSlice[i] & ~group->groupSlice[i]) != 0UL)
+        {
+            covers = false;
+            break;
+        }
+    }
+
+    return covers;
+}
+
+/*!
+ * @brief Set or release the vote of the other core as constraints of the power manager instance.
+ *
+ * Each resource is constrained with the highest operating mode requested by the other core.
+ */
+static void PM_MulticoreApplyPeerVote(pm_multicore_handle_t *mcHandle, bool apply)
+{
+    pm_handle_t *handle = mcHandle->config->handle;
+    uint32_t slice;
+    uint32_t opMode;
+    uint32_t constraint;
+    uint32_t i;
+    uint32_t j;
+
+    if (mcHandle->peerPowerMode < handle->deviceOption->stateCount)
+    {
+        if (apply)
+        {
+            (void)PM_SetConstraintsByHandle(handle, mcHandle->peerPowerMode, 0);
+        }
+        else
+        {
+            (void)PM_ReleaseConstraintsByHandle(handle, mcHandle->peerPowerMode, 0);
+        }
+    }
+
+    for (i = 0U; i < (uint32_t)PM_RESC_GROUP_ARRAY_SIZE; i++)
+    {
+        slice = mcHandle->peerRescGroup.groupSlice[i];
+        for (j = 0U; slice != 0UL; j++, slice >>= 4UL)
+        {
+            if ((slice & 0xFUL) == 0UL)
+            {
+                continue;
+            }
+
+            opMode = (uint32_t)PM_RESOURCE_FULL_ON;
+            while ((slice & opMode) == 0UL)
+            {
+                opMode >>= 1UL;
+            }
+
+            constraint = PM_ENCODE_RESC(opMode, (i * 8UL) + j);
+            if (apply)
+            {
+                (void)PM_SetConstraintsByHandle(handle, PM_LP_STATE_NO_CONSTRAINT, 1, constraint);
+            }
+            else
+            {
+                (void)PM_ReleaseConstraintsByHandle(handle, PM_LP_STATE_NO_CONSTRAINT, 1, constraint);
+            }
+        }
+    }
+}
+
+/*!
+ * @brief Set the constraints of the queues with pending messages, or release the ones set.
+ */
+static void PM_MulticoreHoldQueueConstraints(pm_multicore_handle_t *mcHandle, bool hold)
+{
+    pm_handle_t *handle = mcHandle->config->handle;
+    const pm_multicore_queue_config_t *config;
+    pm_multicore_queue_t *queue;
+    uint32_t i;
+
+    for (queue = mcHandle->queues; queue != NULL; queue = queue->next)
+    {
+        config = queue->config;
+        if (hold)
+        {
+            queue->held = (config->shared->head != config->shared->tail);
+        }
+
+        if (!queue->held)
+        {
+            continue;
+        }
+
+        if (hold)
+        {
+            (void)PM_SetConstraintsByHandle(handle, config->powerModeConstraint, 0);
+            for (i = 0U; i < config->rescCount; i++)
+            {
+                (void)PM_SetConstraintsByHandle(handle, PM_LP_STATE_NO_CONSTRAINT, 1, config->rescConstraints[i]);
+            }
+        }
+        else
+        {
+            (void)PM_ReleaseConstraintsByHandle(handle, config->powerModeConstraint, 0);
+            for (i = 0U; i < config->rescCount; i++)
+            {
+                (void)PM_ReleaseConstraintsByHandle(handle, PM_LP_STATE_NO_CONSTRAINT, 1, config->rescConstraints[i]);
+            }
+            queue->held = false;
+        }
+    }
+}
+
+static void PM_MulticoreQueueNotify(pm_multicore_queue_t *queue)
+{
+    pm_multicore_handle_t *mcHandle = queue->mcHandle;
+
+    mcHandle->config->notifyPeer(mcHandle->config->coreId ^ 1U);
+    mcHandle->doorbellCount++;
+}
+
+/*!
+ * brief Clear the shared memory, to be called by core0 before core1 is started.
+ *
+ * param shared Pointer to the shared memory.
+ */
+void PM_MulticoreInitShared(pm_multicore_shared_t *shared)
+{
+    assert(shared != NULL);
+
+    (void)memset(shared, 0, sizeof(*shared));
+    __DMB();
+}
+
+/*!
+ * brief Initialize the voting of a core and publish its first vote.
+ *
+ * param mcHandle Pointer to the voting state of the core.
+ * param config Configuration, must stay valid while the voting is used.
+ * retval kStatus_PMSuccess The voting is initialized.
+ * retval kStatus_PMFail The core ID is out of range.
+ */
+status_t PM_MulticoreInit(pm_multicore_handle_t *mcHandle, const pm_multicore_config_t *config)
+{
+    status_t status = kStatus_PMSuccess;
+
+    assert(mcHandle != NULL);
+    assert(config != NULL);
+    assert((config->handle != NULL) && (config->shared != NULL) && (config->notifyPeer != NULL));
+
+    if (config->coreId >= PM_MULTICORE_CORE_COUNT)
+    {
+        status = kStatus_PMFail;
+    }
+    else
+    {
+        (void)memset(mcHandle, 0, sizeof(*mcHandle));
+        mcHandle->config = config;
+
+        /* The cleared vote only allows the first power state, the other core is woken up if it waits for this one. */
+        PM_MulticorePublish(mcHandle);
+    }
+
+    return status;
+}
+
+/*!
+ * brief Publish the constraints of the core if they changed since the last vote.
+ *
+ * The other core is woken up if it is idle and the new vote forbids its power state or resources, or may let it
+ * enter a deeper power state.
+ *
+ * param mcHandle Pointer to the voting state of the core.
+ */
+void PM_MulticorePublish(pm_multicore_handle_t *mcHandle)
+{
+    pm_handle_t *handle       = mcHandle->config->handle;
+    pm_multicore_vote_t *own  = PM_MULTICORE_OWN_VOTE(mcHandle);
+    pm_multicore_vote_t *peer = PM_MULTICORE_PEER_VOTE(mcHandle);
+    pm_resc_group_t rescGroup;
+    uint8_t powerModeConstraint;
+    uint32_t regPrimask;
+    bool tightened;
+
+    regPrimask = DisableGlobalIRQ();
+    PM_EnterCriticalRegion(handle);
+    powerModeConstraint = handle->powerModeConstraint;
+    rescGroup           = handle->sysRescGroup;
+    PM_ExitCriticalRegion(handle);
+
+    if ((powerModeConstraint != own->powerModeConstraint) ||
+        (memcmp(&rescGroup, &own->rescGroup, sizeof(rescGroup)) != 0))
+    {
+        tightened = (powerModeConstraint < own->powerModeConstraint) ||
+                    !PM_MulticoreRescGroupCovers(&own->rescGroup, &rescGroup);
+
+        own->sequence++;
+        __DMB();
+        own->powerModeConstraint = powerModeConstraint;
+        own->rescGroup           = rescGroup;
+        __DMB();
+        own->sequence++;
+
+        /* The vote is written before the idle flag of the other core is read, see PM_MulticoreEnterLowPower(). */
+        __DMB();
+        if (peer->idle && (tightened || peer->limitedByPeer))
+        {
+            mcHandle->config->notifyPeer(mcHandle->config->coreId ^ 1U);
+            mcHandle->doorbellCount++;
+        }
+    }
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Check whether the last published vote is taken into account by the other core.
+ *
+ * The vote is taken into account when the other core is running, it reads the vote on its next low power entry, or
+ * when its current low power entry applied it.
+ *
+ * param mcHandle Pointer to the voting state of the core.
+ * return true if the other core honours the last vote.
+ */
+bool PM_MulticoreIsVoteApplied(pm_multicore_handle_t *mcHandle)
+{
+    pm_multicore_vote_t *own  = PM_MULTICORE_OWN_VOTE(mcHandle);
+    pm_multicore_vote_t *peer = PM_MULTICORE_PEER_VOTE(mcHandle);
+
+    return (!peer->idle) || (peer->appliedSequence == own->sequence);
+}
+
+/*!
+ * brief Enter the deepest power state allowed by the constraints of both cores.
+ *
+ * Publishes the vote of the core, applies the vote of the other core and the constraints of the queues with pending
+ * messages to the power manager instance and calls PM_EnterLowPowerByHandle(). The interrupts are masked from the
+ * vote publication to the wakeup, a doorbell raised in between wakes the core up at once.
+ *
+ * param mcHandle Pointer to the voting state of the core.
+ * param duration The time in low power mode, see PM_EnterLowPower().
+ */
+void PM_MulticoreEnterLowPower(pm_multicore_handle_t *mcHandle, uint64_t duration)
+{
+    pm_handle_t *handle       = mcHandle->config->handle;
+    pm_multicore_vote_t *own  = PM_MULTICORE_OWN_VOTE(mcHandle);
+    pm_multicore_vote_t *peer = PM_MULTICORE_PEER_VOTE(mcHandle);
+    uint32_t regPrimask;
+    bool limitedByPeer;
+
+    regPrimask = DisableGlobalIRQ();
+    PM_MulticorePublish(mcHandle);
+
+    /*
+     * The idle flag is written before the vote of the other core is read: either the new vote is read here, or the
+     * other core sees the flag and raises the doorbell. The entry is first assumed limited by the other core, so that
+     * a vote loosened in between also raises it.
+     */
+    own->limitedByPeer = true;
+    own->idle          = true;
+    __DMB();
+    own->appliedSequence = PM_MulticoreReadVote(peer, &mcHandle->peerPowerMode, &mcHandle->peerRescGroup);
+    limitedByPeer        = (mcHandle->peerPowerMode < handle->powerModeConstraint);
+    if (!PM_MulticoreRescGroupCovers(&handle->sysRescGroup, &mcHandle->peerRescGroup))
+    {
+        limitedByPeer = true;
+    }
+    own->limitedByPeer = limitedByPeer;
+
+    PM_MulticoreApplyPeerVote(mcHandle, true);
+    PM_MulticoreHoldQueueConstraints(mcHandle, true);
+    PM_EnterLowPowerByHandle(handle, duration);
+    PM_MulticoreHoldQueueConstraints(mcHandle, false);
+    PM_MulticoreApplyPeerVote(mcHandle, false);
+
+    own->idle = false;
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Initialize one end of a queue and attach it to the voting of the core.
+ *
+ * The end of core0 clears the indexes, it is initialized before core1 is started.
+ *
+ * param queue Pointer to the queue end.
+ * param mcHandle Pointer to the voting state of the core.
+ * param config Configuration, must stay valid while the queue is used.
+ * param producer true for the end that commits the messages, false for the end that consumes them.
+ * retval kStatus_PMSuccess The queue is initialized.
+ * retval kStatus_PMFail The slot count is not a power of 2, or the batch threshold is 0 or larger than the slot
+ * count.
+ */
+status_t PM_MulticoreQueueInit(pm_multicore_queue_t *queue,
+                               pm_multicore_handle_t *mcHandle,
+                               const pm_multicore_queue_config_t *config,
+                               bool producer)
+{
+    status_t status = kStatus_PMSuccess;
+    uint32_t regPrimask;
+
+    assert(queue != NULL);
+    assert((mcHandle != NULL) && (mcHandle->config != NULL));
+    assert(config != NULL);
+    assert((config->shared != NULL) && (config->slots != NULL));
+    assert((((uintptr_t)config->shared) % PM_MULTICORE_QUEUE_LINE_SIZE) == 0U);
+    assert((((uintptr_t)config->slots) % PM_MULTICORE_QUEUE_LINE_SIZE) == 0U);
+    assert((config->slotSize != 0U) && ((config->slotSize % PM_MULTICORE_QUEUE_LINE_SIZE) == 0U));
+    assert((config->rescCount == 0U) || (config->rescConstraints != NULL));
+
+    if ((config->slotCount == 0U) || ((config->slotCount & (config->slotCount - 1U)) != 0U) ||
+        (config->batchThreshold == 0U) || (config->batchThreshold > config->slotCount))
+    {
+        status = kStatus_PMFail;
+    }
+    else
+    {
+        queue->config   = config;
+        queue->mcHandle = mcHandle;
+        queue->producer = producer;
+        queue->held     = false;
+
+        if (mcHandle->config->coreId == 0U)
+        {
+            config->shared->head = 0U;
+            config->shared->tail = 0U;
+            __DMB();
+        }
+
+        regPrimask       = DisableGlobalIRQ();
+        queue->next      = mcHandle->queues;
+        mcHandle->queues = queue;
+        EnableGlobalIRQ(regPrimask);
+    }
+
+    return status;
+}
+
+/*!
+ * brief Get the number of messages committed and not consumed yet.
+ *
+ * param queue Pointer to the queue end, producer or consumer.
+ * return The number of pending messages.
+ */
+uint32_t PM_MulticoreQueueGetPendingCount(pm_multicore_queue_t *queue)
+{
+    uint32_t tail = queue->config->shared->tail;
+
+    return queue->config->shared->head - tail;
+}
+
+/*!
+ * brief Reserve the next slot of the queue, to be filled in place by the producer.
+ *
+ * The same slot is returned until it is committed.
+ *
+ * param queue Pointer to the producer end.
+ * return Pointer to the slot, or NULL if the queue is full.
+ */
+void *PM_MulticoreQueueReserve(pm_multicore_queue_t *queue)
+{
+    const pm_multicore_queue_config_t *config = queue->config;
+    uint32_t head                             = config->shared->head;
+    void *slot                                = NULL;
+
+    assert(queue->producer);
+
+    if ((head - config->shared->tail) < config->slotCount)
+    {
+        /* The consumer is done with the slot before the tail is written. */
+        __DMB();
+        slot = PM_MULTICORE_QUEUE_SLOT(config, head);
+    }
+
+    return slot;
+}
+
+/*!
+ * brief Commit the reserved slot.
+ *
+ * The consumer is woken up when the number of pending messages reaches the batch threshold.
+ *
+ * param queue Pointer to the producer end.
+ */
+void PM_MulticoreQueueCommit(pm_multicore_queue_t *queue)
+{
+    const pm_multicore_queue_config_t *config = queue->config;
+    uint32_t head                             = config->shared->head + 1U;
+
+    assert(queue->producer);
+    assert((head - config->shared->tail) <= config->slotCount);
+
+    /* The message is written before it is published. */
+    __DMB();
+    config->shared->head = head;
+
+    /*
+     * The tail does not move while the consumer sleeps, the count then reaches the threshold once per batch. A
+     * consumer that moved the tail in between is running and reads the message before it enters low power again.
+     */
+    if ((head - config->shared->tail) == config->batchThreshold)
+    {
+        PM_MulticoreQueueNotify(queue);
+    }
+}
+
+/*!
+ * brief Wake the consumer up if messages are pending, whatever their number.
+ *
+ * param queue Pointer to the producer end.
+ */
+void PM_MulticoreQueueFlush(pm_multicore_queue_t *queue)
+{
+    assert(queue->producer);
+
+    if (PM_MulticoreQueueGetPendingCount(queue) != 0U)
+    {
+        PM_MulticoreQueueNotify(queue);
+    }
+}
+
+/*!
+ * brief Get the oldest message, to be read in place by the consumer.
+ *
+ * The same message is returned until it is consumed.
+ *
+ * param queue Pointer to the consumer end.
+ * return Pointer to the message, or NULL if no message is pending.
+ */
+void *PM_MulticoreQueuePeek(pm_multicore_queue_t *queue)
+{
+    const pm_multicore_queue_config_t *config = queue->config;
+    uint32_t tail                             = config->shared->tail;
+    void *message                             = NULL;
+
+    assert(!queue->producer);
+
+    if (config->shared->head != tail)
+    {
+        /* The head is read before the message. */
+        __DMB();
+        message = PM_MULTICORE_QUEUE_SLOT(config, tail);
+    }
+
+    return message;
+}
+
+/*!
+ * brief Free the slot of the oldest message.
+ *
+ * param queue Pointer to the consumer end.
+ */
+void PM_MulticoreQueueConsume(pm_multicore_queue_t *queue)
+{
+    const pm_multicore_queue_config_t *config = queue->config;
+    uint32_t tail                             = config->shared->tail;
+
+    assert(!queue->producer);
+    assert(config->shared->head != tail);
+
+    /* The message is read before the slot is freed. */
+    __DMB();
+    config->shared->tail = tail + 1U;
+}
+
+#if (defined(FSL_FEATURE_SOC_MAILBOX_COUNT) && FSL_FEATURE_SOC_MAILBOX_COUNT)
+/*!
+ * brief Raise the mailbox interrupt of a core.
+ *
+ * Matches pm_multicore_notify_func_t, the mailbox must be initialized with MAILBOX_Init().
+ *
+ * param peerId The core to wake up.
+ */
+void PM_MulticoreMailboxNotify(uint8_t peerId)
+{
+    MAILBOX_SetValueBits(MAILBOX, (mailbox_cpu_id_t)peerId, PM_MULTICORE_MAILBOX_FLAG);
+}
+
+/*!
+ * brief Acknowledge the doorbell, to be called from the mailbox interrupt handler.
+ *
+ * The vote of the other core is read on the next low power entry, the interrupt only wakes the core up.
+ *
+ * param coreId ID of the calling core.
+ * return true if the doorbell was raised, other bits of the mailbox register are left unchanged.
+ */
+bool PM_MulticoreMailboxHandleIRQ(uint8_t coreId)
+{
+    bool raised = false;
+
+    if ((MAILBOX_GetValue(MAILBOX, (mailbox_cpu_id_t)coreId) & PM_MULTICORE_MAILBOX_FLAG) != 0UL)
+    {
+        MAILBOX_ClearValueBits(MAILBOX, (mailbox_cpu_id_t)coreId, PM_MULTICORE_MAILBOX_FLAG);
+        raised = true;
+    }
+
+    return raised;
+}
+#endif /* FSL_FEATURE_SOC_MAILBOX_COUNT */
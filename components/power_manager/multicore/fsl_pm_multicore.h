@@ -0,0 +1,385 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_PM_MULTICORE_H_
+#define _FSL_PM_MULTICORE_H_
+
+#include "fsl_common.h"
+#include "fsl_pm_core.h"
+
+/*!
+ * @addtogroup PM Framework: Power Manager Framework
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @name Dual-core constraint voting
+ *
+ * Each core runs its own power manager instance and publishes a vote in a memory shared by both cores: the deepest
+ * power state and the resources allowed by its constraints, and whether it is idle. Before entering a low power state,
+ * a core applies the vote of the other core as constraints of its own instance, so the power state entered is one
+ * that both cores allow and the resources needed by the other core are kept. A core that is running does not limit
+ * the other one otherwise: core1 can enter a low power state while core0 stays active, the system low power mode
+ * takes effect once both cores are in low power.
+ *
+ * When a vote changes while the other core is idle, the other core is woken up by a mailbox interrupt if it must leave
+ * a power state that is no longer allowed, or if it may enter a deeper one. A running core reads the vote on its next
+ * low power entry and is not interrupted.
+ *
+ * Both cores index the power states the same way. The shared memory is placed at the same address in both images,
+ * for example in the rpmsg_sh_mem region of the linker files, and is cleared by core0 before core1 is started. Until
+ * core1 has published its vote, core0 only enters the first power state.
+ * @code
+ * #define APP_PM_SHARED ((pm_multicore_shared_t *)0x2004DF00U)
+ *
+ * static const pm_multicore_config_t s_multicoreConfig = {
+ *     .handle     = &g_pmHandle,
+ *     .shared     = APP_PM_SHARED,
+ *     .coreId     = 0U,
+ *     .notifyPeer = PM_MulticoreMailboxNotify,
+ * };
+ * static pm_multicore_handle_t s_multicoreHandle;
+ *
+ * PM_MulticoreInitShared(APP_PM_SHARED);
+ * PM_MulticoreInit(&s_multicoreHandle, &s_multicoreConfig);
+ * // Start core1.
+ *
+ * while (true)
+ * {
+ *     PM_MulticoreEnterLowPower(&s_multicoreHandle, duration);
+ * }
+ *
+ * void MAILBOX_IRQHandler(void)
+ * {
+ *     (void)PM_MulticoreMailboxHandleIRQ(0U);
+ * }
+ * @endcode
+ * After changing its constraints, a core calls PM_MulticorePublish() so that an idle peer is woken up when needed,
+ * the vote is also published on each low power entry.
+ * @{
+ */
+
+/*! @brief Number of cores sharing the power manager votes. */
+#define PM_MULTICORE_CORE_COUNT (2U)
+
+#ifndef PM_MULTICORE_MAILBOX_FLAG
+/*! @brief Bit of the mailbox register used as doorbell. */
+#define PM_MULTICORE_MAILBOX_FLAG (1UL << 31U)
+#endif /* PM_MULTICORE_MAILBOX_FLAG */
+
+/*! @} */
+
+/*!
+ * @name Inter-core queue
+ *
+ * Single-producer single-consumer ring of fixed-size messages in shared memory, used to hand work over to the other
+ * core. The messages are written and read in place: the producer reserves a slot, fills it and commits it, the
+ * consumer peeks at the oldest message and consumes it once processed. No lock is taken, the producer only writes the
+ * head index and the consumer only writes the tail index, each one on its own cache line.
+ *
+ * The consumer is woken up by the mailbox doorbell when the number of pending messages reaches the batch threshold of
+ * the queue, smaller batches wait for the next wakeup of the consumer or PM_MulticoreQueueFlush(). While messages are
+ * pending, both cores hold the constraints of the queue on their low power entries, so the system does not enter a
+ * power state in which the consumer could not process them.
+ * @code
+ * static pm_multicore_queue_shared_t s_sensorQueueShared; // In the shared memory.
+ * static uint8_t s_sensorSlots[8U * 32U];                 // In the shared memory, aligned to the cache line.
+ * static const uint32_t s_sensorRescConstraints[] = {PM_RESC_CORE_WAKE_DEEP_SLEEP};
+ * static const pm_multicore_queue_config_t s_sensorQueueConfig = {
+ *     .shared              = &s_sensorQueueShared,
+ *     .slots               = s_sensorSlots,
+ *     .slotCount           = 8U,
+ *     .slotSize            = 32U,
+ *     .batchThreshold      = 4U,
+ *     .powerModeConstraint = PM_LP_STATE_DEEP_SLEEP,
+ *     .rescConstraints     = s_sensorRescConstraints,
+ *     .rescCount           = ARRAY_SIZE(s_sensorRescConstraints),
+ * };
+ * static pm_multicore_queue_t s_sensorQueue;
+ *
+ * // Core0, producer.
+ * PM_MulticoreQueueInit(&s_sensorQueue, &s_multicoreHandle, &s_sensorQueueConfig, true);
+ * sample = PM_MulticoreQueueReserve(&s_sensorQueue);
+ * if (sample != NULL)
+ * {
+ *     APP_ReadSensor(sample);
+ *     PM_MulticoreQueueCommit(&s_sensorQueue);
+ * }
+ *
+ * // Core1, consumer.
+ * PM_MulticoreQueueInit(&s_sensorQueue, &s_multicoreHandle, &s_sensorQueueConfig, false);
+ * while ((sample = PM_MulticoreQueuePeek(&s_sensorQueue)) != NULL)
+ * {
+ *     APP_ProcessSample(sample);
+ *     PM_MulticoreQueueConsume(&s_sensorQueue);
+ * }
+ * PM_MulticoreEnterLowPower(&s_multicoreHandle, duration);
+ * @endcode
+ * @{
+ */
+
+#ifndef PM_MULTICORE_QUEUE_LINE_SIZE
+/*! @brief Cache line size, the indexes and the slots of the queues are aligned to it. */
+#define PM_MULTICORE_QUEUE_LINE_SIZE (32U)
+#endif /* PM_MULTICORE_QUEUE_LINE_SIZE */
+
+/*! @} */
+
+/*!
+ * @brief Vote of one core, written by that core only.
+ */
+typedef struct _pm_multicore_vote
+{
+    volatile uint32_t sequence;        /*!< Incremented before and after each update, odd while the vote is written. */
+    volatile uint32_t appliedSequence; /*!< Sequence of the vote of the other core applied by the last low power
+                                            entry. */
+    volatile bool idle;                /*!< The core is in low power, or about to enter it. */
+    volatile bool limitedByPeer;       /*!< The vote of the other core limited the current low power entry. */
+    uint8_t powerModeConstraint;       /*!< Deepest power state allowed by the constraints of the core. */
+    pm_resc_group_t rescGroup;         /*!< Operating modes of the resources needed by the core. */
+} pm_multicore_vote_t;
+
+/*!
+ * @brief Memory shared by both cores.
+ */
+typedef struct _pm_multicore_shared
+{
+    pm_multicore_vote_t votes[PM_MULTICORE_CORE_COUNT];
+} pm_multicore_shared_t;
+
+/*!
+ * @brief Doorbell function, raises the mailbox interrupt of the core peerId.
+ */
+typedef void (*pm_multicore_notify_func_t)(uint8_t peerId);
+
+/*!
+ * @brief Configuration of the voting on one core.
+ */
+typedef struct _pm_multicore_config
+{
+    pm_handle_t *handle;                   /*!< Power manager instance of the core. */
+    pm_multicore_shared_t *shared;         /*!< Memory shared by both cores. */
+    uint8_t coreId;                        /*!< 0 for core0, 1 for core1. */
+    pm_multicore_notify_func_t notifyPeer; /*!< Doorbell of the other core. */
+} pm_multicore_config_t;
+
+/*!
+ * @brief Voting state of one core, the memory is provided by the application.
+ */
+typedef struct _pm_multicore_handle
+{
+    const pm_multicore_config_t *config;
+    uint8_t peerPowerMode;              /*!< Power mode constraint of the other core applied during the low power
+                                             entry. */
+    pm_resc_group_t peerRescGroup;      /*!< Resources of the other core applied during the low power entry. */
+    uint32_t doorbellCount;             /*!< Number of times the other core was woken up. */
+    struct _pm_multicore_queue *queues; /*!< Queues of the core, their constraints are held while messages are
+                                             pending. */
+} pm_multicore_handle_t;
+
+/*!
+ * @brief Indexes of a queue, in the shared memory.
+ */
+typedef struct _pm_multicore_queue_shared
+{
+    volatile uint32_t head; /*!< Number of messages committed, written by the producer. */
+    uint8_t headPadding[PM_MULTICORE_QUEUE_LINE_SIZE - sizeof(uint32_t)];
+    volatile uint32_t tail; /*!< Number of messages consumed, written by the consumer. */
+    uint8_t tailPadding[PM_MULTICORE_QUEUE_LINE_SIZE - sizeof(uint32_t)];
+} pm_multicore_queue_shared_t;
+
+/*!
+ * @brief Configuration of a queue, the same on both cores.
+ */
+typedef struct _pm_multicore_queue_config
+{
+    pm_multicore_queue_shared_t *shared; /*!< Indexes in the shared memory, aligned to the cache line. */
+    uint8_t *slots;                      /*!< slotCount * slotSize bytes of shared memory, aligned to the cache
+                                              line. */
+    uint32_t slotCount;                  /*!< Number of slots, a power of 2. */
+    uint32_t slotSize;                   /*!< Size of a slot in bytes, a multiple of the cache line size. */
+    uint32_t batchThreshold;             /*!< Number of pending messages that wakes the consumer up, 1 to wake it
+                                              up for each message. */
+    uint8_t powerModeConstraint;         /*!< Power mode constraint held while messages are pending,
+                                              PM_LP_STATE_NO_CONSTRAINT for none. */
+    const uint32_t *rescConstraints;     /*!< Resource constraints held while messages are pending. */
+    uint8_t rescCount;                   /*!< Number of resource constraints. */
+} pm_multicore_queue_config_t;
+
+/*!
+ * @brief One end of a queue, the memory is provided by the application.
+ */
+typedef struct _pm_multicore_queue
+{
+    const pm_multicore_queue_config_t *config;
+    pm_multicore_handle_t *mcHandle;
+    bool producer;                    /*!< This end commits the messages, the other end consumes them. */
+    bool held;                        /*!< The constraints are held for the current low power entry. */
+    struct _pm_multicore_queue *next; /*!< Next queue of the core. */
+} pm_multicore_queue_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Clear the shared memory, to be called by core0 before core1 is started.
+ *
+ * @param shared Pointer to the shared memory.
+ */
+void PM_MulticoreInitShared(pm_multicore_shared_t *shared);
+
+/*!
+ * @brief Initialize the voting of a core and publish its first vote.
+ *
+ * @param mcHandle Pointer to the voting state of the core.
+ * @param config Configuration, must stay valid while the voting is used.
+ * @retval kStatus_PMSuccess The voting is initialized.
+ * @retval kStatus_PMFail The core ID is out of range.
+ */
+status_t PM_MulticoreInit(pm_multicore_handle_t *mcHandle, const pm_multicore_config_t *config);
+
+/*!
+ * @brief Publish the constraints of the core if they changed since the last vote.
+ *
+ * The other core is woken up if it is idle and the new vote forbids its power state or resources, or may let it
+ * enter a deeper power state.
+ *
+ * @param mcHandle Pointer to the voting state of the core.
+ */
+void PM_MulticorePublish(pm_multicore_handle_t *mcHandle);
+
+/*!
+ * @brief Check whether the last published vote is taken into account by the other core.
+ *
+ * The vote is taken into account when the other core is running, it reads the vote on its next low power entry, or
+ * when its current low power entry applied it.
+ *
+ * @param mcHandle Pointer to the voting state of the core.
+ * @return true if the other core honours the last vote.
+ */
+bool PM_MulticoreIsVoteApplied(pm_multicore_handle_t *mcHandle);
+
+/*!
+ * @brief Enter the deepest power state allowed by the constraints of both cores.
+ *
+ * Publishes the vote of the core, applies the vote of the other core and the constraints of the queues with pending
+ * messages to the power manager instance and calls PM_EnterLowPowerByHandle(). The interrupts are masked from the
+ * vote publication to the wakeup, a doorbell raised in between wakes the core up at once.
+ *
+ * @param mcHandle Pointer to the voting state of the core.
+ * @param duration The time in low power mode, see PM_EnterLowPower().
+ */
+void PM_MulticoreEnterLowPower(pm_multicore_handle_t *mcHandle, uint64_t duration);
+
+/*!
+ * @brief Initialize one end of a queue and attach it to the voting of the core.
+ *
+ * The end of core0 clears the indexes, it is initialized before core1 is started.
+ *
+ * @param queue Pointer to the queue end.
+ * @param mcHandle Pointer to the voting state of the core.
+ * @param config Configuration, must stay valid while the queue is used.
+ * @param producer true for the end that commits the messages, false for the end that consumes them.
+ * @retval kStatus_PMSuccess The queue is initialized.
+ * @retval kStatus_PMFail The slot count is not a power of 2, or the batch threshold is 0 or larger than the slot
+ * count.
+ */
+status_t PM_MulticoreQueueInit(pm_multicore_queue_t *queue,
+                               pm_multicore_handle_t *mcHandle,
+                               const pm_multicore_queue_config_t *config,
+                               bool producer);
+
+/*!
+ * @brief Get the number of messages committed and not consumed yet.
+ *
+ * @param queue Pointer to the queue end, producer or consumer.
+ * @return The number of pending messages.
+ */
+uint32_t PM_MulticoreQueueGetPendingCount(pm_multicore_queue_t *queue);
+
+/*!
+ * @brief Reserve the next slot of the queue, to be filled in place by the producer.
+ *
+ * The same slot is returned until it is committed.
+ *
+ * @param queue Pointer to the producer end.
+ * @return Pointer to the slot, or NULL if the queue is full.
+ */
+void *PM_MulticoreQueueReserve(pm_multicore_queue_t *queue);
+
+/*!
+ * @brief Commit the reserved slot.
+ *
+ * The consumer is woken up when the number of pending messages reaches the batch threshold.
+ *
+ * @param queue Pointer to the producer end.
+ */
+void PM_MulticoreQueueCommit(pm_multicore_queue_t *queue);
+
+/*!
+ * @brief Wake the consumer up if messages are pending, whatever their number.
+ *
+ * @param queue Pointer to the producer end.
+ */
+void PM_MulticoreQueueFlush(pm_multicore_queue_t *queue);
+
+/*!
+ * @brief Get the oldest message, to be read in place by the consumer.
+ *
+ * The same message is returned until it is consumed.
+ *
+ * @param queue Pointer to the consumer end.
+ * @return Pointer to the message, or NULL if no message is pending.
+ */
+void *PM_MulticoreQueuePeek(pm_multicore_queue_t *queue);
+
+/*!
+ * @brief Free the slot of the oldest message.
+ *
+ * @param queue Pointer to the consumer end.
+ */
+void PM_MulticoreQueueConsume(pm_multicore_queue_t *queue);
+
+#if (defined(FSL_FEATURE_SOC_MAILBOX_COUNT) && FSL_FEATURE_SOC_MAILBOX_COUNT)
+/*!
+ * @brief Raise the mailbox interrupt of a core.
+ *
+ * Matches @ref pm_multicore_notify_func_t, the mailbox must be initialized with MAILBOX_Init().
+ *
+ * @param peerId The core to wake up.
+ */
+void PM_MulticoreMailboxNotify(uint8_t peerId);
+
+/*!
+ * @brief Acknowledge the doorbell, to be called from the mailbox interrupt handler.
+ *
+ * The vote of the other core is read on the next low power entry, the interrupt only wakes the core up.
+ *
+ * @param coreId ID of the calling core.
+ * @return true if the doorbell was raised, other bits of the mailbox register are left unchanged.
+ */
+bool PM_MulticoreMailboxHandleIRQ(uint8_t coreId);
+#endif /* FSL_FEATURE_SOC_MAILBOX_COUNT */
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*!
+ * @}
+ */
+
+#endif /* _FSL_PM_MULTICORE_H_ */
@@ -0,0 +1,217 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Tick compensation of the FreeRTOS tickless idle adapter, without kernel.
+ *
+ * The test plays the kernel and the tick interrupt on the simulated time of the host board. Each round, the idle
+ * task runs some time after the last tick and asks to sleep until a task unblocks; an interrupt sometimes wakes the
+ * device up earlier. After the sleep, the tick count stepped by the adapter must match the time spent, the next tick
+ * must stay in phase with the previous ones, and the tick count must never pass the unblock time.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "fsl_pm_freertos.h"
+#include "pm_host_board.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PM_TEST_ROUNDS        (20000U)
+#define PM_TEST_MAX_IDLE_TIME (3000U)
+
+#define PM_TEST_CHECK(condition)                                                                              \
+    do                                                                                                        \
+    {                                                                                                         \
+        if (!(condition))                                                                                     \
+        {                                                                                                     \
+            (void)printf("FAIL: %s, line %d, time %llu, tick count %u\n", #condition, __LINE__,             \
+                         (unsigned long long)g_pmHostTime, (unsigned int)s_tickCount);                        \
+            return 1;                                                                                         \
+        }                                                                                                     \
+    } while (false)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static uint32_t PM_TestStopTick(void);
+static void PM_TestStartTick(uint32_t firstPeriod);
+static uint64_t PM_TestGetTimestamp(void);
+static uint64_t PM_TestGetDuration(uint64_t entryTimestamp, uint64_t exitTimestamp);
+static uint64_t PM_TestUsToTimestamp(uint64_t us);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static pm_handle_t s_pmHandle;
+
+static const pm_freertos_tickless_config_t s_ticklessConfig = {
+    .stopTick      = PM_TestStopTick,
+    .startTick     = PM_TestStartTick,
+    .getTimestamp  = PM_TestGetTimestamp,
+    .getDuration   = PM_TestGetDuration,
+    .usToTimestamp = PM_TestUsToTimestamp,
+};
+
+/* Kernel state */
+static eSleepModeStatus s_sleepStatus = eStandardSleep;
+static TickType_t s_tickCount;
+static TickType_t s_unblockTick;
+static bool s_stepPastUnblock;
+
+/* Tick interrupt state, times in us */
+static uint64_t s_lastTick;
+static uint64_t s_nextTick;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+eSleepModeStatus eTaskConfirmSleepModeStatus(void)
+{
+    return s_sleepStatus;
+}
+
+void vTaskStepTick(TickType_t xTicksToJump)
+{
+    /* The kernel asserts that the tick count does not pass the unblock time. */
+    if ((s_tickCount + xTicksToJump) > s_unblockTick)
+    {
+        s_stepPastUnblock = true;
+    }
+
+    s_tickCount += xTicksToJump;
+}
+
+static uint32_t PM_TestStopTick(void)
+{
+    return (uint32_t)(g_pmHostTime - s_lastTick);
+}
+
+static void PM_TestStartTick(uint32_t firstPeriod)
+{
+    s_nextTick = g_pmHostTime + firstPeriod;
+}
+
+static uint64_t PM_TestGetTimestamp(void)
+{
+    return g_pmHostTime;
+}
+
+static uint64_t PM_TestGetDuration(uint64_t entryTimestamp, uint64_t exitTimestamp)
+{
+    return exitTimestamp - entryTimestamp;
+}
+
+static uint64_t PM_TestUsToTimestamp(uint64_t us)
+{
+    return us;
+}
+
+/* The tick interrupt fires. */
+static void PM_TestTick(void)
+{
+    g_pmHostTime = s_nextTick;
+    s_lastTick   = s_nextTick;
+    s_nextTick   = s_lastTick + PM_FREERTOS_TICK_US;
+    s_tickCount++;
+}
+
+int main(void)
+{
+    uint64_t lastTick;
+    uint64_t drift;
+    uint32_t steppedTotal = 0U;
+    uint32_t lateTicks    = 0U;
+    uint32_t enterCount;
+    TickType_t expected;
+    TickType_t tickCount;
+    TickType_t stepped;
+    uint32_t i;
+
+    PM_HostReset();
+    PM_CreateHandle(&s_pmHandle);
+    PM_EnablePowerManager(true);
+    PM_HostRegisterTimer(&s_pmHandle);
+    (void)PM_SetConstraints(PM_LP_STATE_POWER_DOWN_WAKE_PD, 0);
+    PM_FreeRTOSInitTickless(&s_ticklessConfig);
+    srand(45U);
+
+    s_nextTick = PM_FREERTOS_TICK_US;
+
+    for (i = 0U; i < PM_TEST_ROUNDS; i++)
+    {
+        expected      = 2U + ((TickType_t)rand() % PM_TEST_MAX_IDLE_TIME);
+        s_unblockTick = s_tickCount + expected;
+        lastTick      = s_lastTick;
+        tickCount     = s_tickCount;
+
+        /* The idle task runs within the tick period, an interrupt wakes up the device early one round out of four. */
+        g_pmHostTime      = s_lastTick + ((uint64_t)rand() % PM_FREERTOS_TICK_US);
+        g_pmHostNextEvent = ((rand() % 4) == 0) ?
+                                (g_pmHostTime + ((uint64_t)rand() % ((uint64_t)expected * PM_FREERTOS_TICK_US))) :
+                                PM_HOST_NO_EVENT;
+
+        PM_FreeRTOSSuppressTicksAndSleep(expected);
+        stepped = s_tickCount - tickCount;
+        steppedTotal += stepped;
+
+        PM_TEST_CHECK(!s_stepPastUnblock);
+        PM_TEST_CHECK(stepped < expected);
+        /* The device wakes up before the task unblocks. */
+        PM_TEST_CHECK(g_pmHostTime <= (lastTick + ((uint64_t)expected * PM_FREERTOS_TICK_US)));
+        PM_TEST_CHECK(s_nextTick > g_pmHostTime);
+
+        /*
+         * The next tick stays in phase. When the device wakes up right at the unblock time, the tick of the unblock
+         * is due at once and comes 1 us late.
+         */
+        if (s_nextTick != (lastTick + ((uint64_t)(stepped + 1U) * PM_FREERTOS_TICK_US)))
+        {
+            PM_TEST_CHECK((stepped == (expected - 1U)) && (s_nextTick == (g_pmHostTime + 1U)));
+            lateTicks++;
+        }
+
+        PM_TestTick();
+        PM_TEST_CHECK(s_tickCount <= s_unblockTick);
+
+        /* The tick count follows the time, only the late ticks of the unblock times add up. */
+        drift = s_lastTick - ((uint64_t)s_tickCount * PM_FREERTOS_TICK_US);
+        PM_TEST_CHECK(drift <= lateTicks);
+    }
+
+    PM_TEST_CHECK(PM_FreeRTOSGetSuppressedTicks() == steppedTotal);
+
+    /* Without task waiting for a timeout, only the interrupt wakes up the device. */
+    s_sleepStatus     = eNoTasksWaitingTimeout;
+    s_unblockTick     = portMAX_DELAY;
+    lastTick          = s_lastTick;
+    tickCount         = s_tickCount;
+    g_pmHostTime      = s_lastTick + 100U;
+    g_pmHostNextEvent = g_pmHostTime + (5000U * PM_FREERTOS_TICK_US) + 300U;
+    PM_FreeRTOSSuppressTicksAndSleep(portMAX_DELAY);
+    PM_TEST_CHECK(g_pmHostTime == g_pmHostNextEvent);
+    PM_TEST_CHECK((s_tickCount - tickCount) == 5000U);
+    PM_TEST_CHECK(s_nextTick == (lastTick + (5001U * PM_FREERTOS_TICK_US)));
+
+    /* A task became ready, the tick keeps running. */
+    s_sleepStatus = eAbortSleep;
+    enterCount    = g_pmHostEnterCount;
+    tickCount     = s_tickCount;
+    s_nextTick    = 0U;
+    PM_FreeRTOSSuppressTicksAndSleep(100U);
+    PM_TEST_CHECK((g_pmHostEnterCount == enterCount) && (s_tickCount == tickCount) && (s_nextTick == 0U));
+
+    (void)printf("%u ticks suppressed, %u late ticks\n", (unsigned int)steppedTotal, (unsigned int)lateTicks);
+
+    return 0;
+}
@@ -0,0 +1,53 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*
+ * Kernel configuration of the tickless idle test on the FreeRTOS POSIX port. The port has no tickless support, the
+ * idle task calls the adapter through portSUPPRESS_TICKS_AND_SLEEP(). The interrupts of the port are signals, the
+ * adapter masks them with the port functions.
+ */
+
+#include <assert.h>
+#include <stdint.h>
+
+#define configUSE_PREEMPTION                  1
+#define configUSE_IDLE_HOOK                   0
+#define configUSE_TICK_HOOK                   1
+#define configTICK_RATE_HZ                    1000
+#define configTICK_TYPE_WIDTH_IN_BITS         TICK_TYPE_WIDTH_32_BITS
+#define configMAX_PRIORITIES                  5
+#define configMINIMAL_STACK_SIZE              ((unsigned short)4096)
+#define configTOTAL_HEAP_SIZE                 ((size_t)(256 * 1024))
+#define configMAX_TASK_NAME_LEN               16
+#define configUSE_MUTEXES                     1
+#define configUSE_TIMERS                      0
+#define configSUPPORT_DYNAMIC_ALLOCATION      1
+#define configSUPPORT_STATIC_ALLOCATION       0
+#define configCHECK_FOR_STACK_OVERFLOW        0
+#define configUSE_MALLOC_FAILED_HOOK          0
+#define configUSE_TICKLESS_IDLE               2
+#define configEXPECTED_IDLE_TIME_BEFORE_SLEEP 2
+
+#define INCLUDE_vTaskDelay                  1
+#define INCLUDE_vTaskDelete                 1
+#define INCLUDE_xTaskGetCurrentTaskHandle   1
+#define INCLUDE_xTaskGetSchedulerState      1
+#define INCLUDE_vTaskSuspend                1
+
+#define configASSERT(x) assert(x)
+
+/* TickType_t is uint32_t with 32-bit ticks, the kernel types are not defined yet. */
+void PM_FreeRTOSSuppressTicksAndSleep(uint32_t expectedIdleTime);
+#define portSUPPRESS_TICKS_AND_SLEEP(expectedIdleTime) PM_FreeRTOSSuppressTicksAndSleep(expectedIdleTime)
+
+#define PM_FREERTOS_DISABLE_IRQ()       (portDISABLE_INTERRUPTS(), 0U)
+#define PM_FREERTOS_ENABLE_IRQ(primask) ((void)(primask), portENABLE_INTERRUPTS())
+
+#endif /* FREERTOS_CONFIG_H */
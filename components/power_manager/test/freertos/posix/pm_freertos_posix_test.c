@@ -0,0 +1,231 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Tickless idle on the FreeRTOS POSIX port.
+ *
+ * A task sleeps with vTaskDelay() while the idle task suppresses the tick through the adapter. The low power timer
+ * is simulated on the monotonic clock: entering a power state waits until the timer expires, plus the exit latency
+ * of the state. The tick of the port is a signal: while the tick is stopped, the signals are masked and the pending
+ * ticks are discarded, the adapter steps the tick count instead. The tick count must then follow the time, and no
+ * task may unblock before its time.
+ */
+
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "fsl_pm_freertos.h"
+#include "pm_host_board.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PM_POSIX_TEST_ROUNDS (10U)
+#define PM_POSIX_NO_TIMER    (UINT64_MAX)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void PM_PosixEnter(uint8_t powerState, pm_resc_mask_t *pSoftRescMask, pm_resc_group_t *pSysRescGroup);
+static void PM_PosixTimerStart(uint64_t timeout);
+static void PM_PosixTimerStop(void);
+static uint64_t PM_PosixGetTimestamp(void);
+static uint64_t PM_PosixGetDuration(uint64_t entryTimestamp, uint64_t exitTimestamp);
+static uint64_t PM_PosixUsToTimestamp(uint64_t us);
+static uint32_t PM_PosixStopTick(void);
+static void PM_PosixStartTick(uint32_t firstPeriod);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static pm_handle_t s_pmHandle;
+
+static const pm_freertos_tickless_config_t s_ticklessConfig = {
+    .stopTick      = PM_PosixStopTick,
+    .startTick     = PM_PosixStartTick,
+    .getTimestamp  = PM_PosixGetTimestamp,
+    .getDuration   = PM_PosixGetDuration,
+    .usToTimestamp = PM_PosixUsToTimestamp,
+};
+
+static const TickType_t s_delays[] = {2U, 5U, 10U, 50U, 100U, 3U, 200U};
+
+static uint64_t s_timerExpiry = PM_POSIX_NO_TIMER;
+static uint32_t s_enterCount;
+
+/* Timestamp of the last tick counted by the kernel, written by the tick hook. */
+static volatile uint64_t s_lastTick;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void PM_PosixEnter(uint8_t powerState, pm_resc_mask_t *pSoftRescMask, pm_resc_group_t *pSysRescGroup)
+{
+    uint64_t wakeup;
+    struct timespec wakeupTime;
+
+    (void)pSoftRescMask;
+    (void)pSysRescGroup;
+
+    if (s_timerExpiry != PM_POSIX_NO_TIMER)
+    {
+        wakeup             = s_timerExpiry + g_devicePMOption.states[powerState].exitLatency;
+        wakeupTime.tv_sec  = (time_t)(wakeup / 1000000U);
+        wakeupTime.tv_nsec = (long)((wakeup % 1000000U) * 1000U);
+        (void)clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeupTime, NULL);
+    }
+
+    s_enterCount++;
+}
+
+static void PM_PosixTimerStart(uint64_t timeout)
+{
+    uint64_t now = PM_PosixGetTimestamp();
+
+    s_timerExpiry = (timeout < (PM_POSIX_NO_TIMER - now)) ? (now + timeout) : PM_POSIX_NO_TIMER;
+}
+
+static void PM_PosixTimerStop(void)
+{
+    s_timerExpiry = PM_POSIX_NO_TIMER;
+}
+
+static uint64_t PM_PosixGetTimestamp(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * 1000000U) + ((uint64_t)now.tv_nsec / 1000U);
+}
+
+static uint64_t PM_PosixGetDuration(uint64_t entryTimestamp, uint64_t exitTimestamp)
+{
+    return exitTimestamp - entryTimestamp;
+}
+
+static uint64_t PM_PosixUsToTimestamp(uint64_t us)
+{
+    return us;
+}
+
+/* The signals are masked by the adapter, discard the ticks of the port raised meanwhile. */
+static void PM_PosixDiscardPendingTicks(void)
+{
+    sigset_t tickSignal;
+    struct timespec noWait = {0, 0};
+
+    (void)sigemptyset(&tickSignal);
+    (void)sigaddset(&tickSignal, SIGALRM);
+    while (sigtimedwait(&tickSignal, NULL, &noWait) == SIGALRM)
+    {
+    }
+}
+
+static uint32_t PM_PosixStopTick(void)
+{
+    PM_PosixDiscardPendingTicks();
+
+    return (uint32_t)(PM_PosixGetTimestamp() - s_lastTick);
+}
+
+/* The port keeps its own tick phase, only the reference of the next stop is moved. */
+static void PM_PosixStartTick(uint32_t firstPeriod)
+{
+    PM_PosixDiscardPendingTicks();
+
+    s_lastTick = PM_PosixGetTimestamp() + firstPeriod - PM_FREERTOS_TICK_US;
+}
+
+void vApplicationTickHook(void)
+{
+    s_lastTick = PM_PosixGetTimestamp();
+}
+
+static void PM_PosixTestTask(void *param)
+{
+    uint64_t start;
+    uint64_t before;
+    uint64_t elapsed;
+    TickType_t startTick;
+    TickType_t ticks;
+    TickType_t delay;
+    int failures = 0;
+    uint32_t i;
+
+    (void)param;
+
+    start     = PM_PosixGetTimestamp();
+    startTick = xTaskGetTickCount();
+
+    for (i = 0U; i < (PM_POSIX_TEST_ROUNDS * (sizeof(s_delays) / sizeof(s_delays[0]))); i++)
+    {
+        delay  = s_delays[i % (sizeof(s_delays) / sizeof(s_delays[0]))];
+        before = PM_PosixGetTimestamp();
+        vTaskDelay(delay);
+        elapsed = PM_PosixGetTimestamp() - before;
+
+        /* The delay starts within a tick period, the task must not unblock earlier. */
+        if ((elapsed + (2U * PM_FREERTOS_TICK_US)) < ((uint64_t)delay * PM_FREERTOS_TICK_US))
+        {
+            (void)printf("FAIL: vTaskDelay(%u) returned after %llu us\n", (unsigned int)delay,
+                         (unsigned long long)elapsed);
+            failures++;
+        }
+    }
+
+    ticks   = xTaskGetTickCount() - startTick;
+    elapsed = PM_PosixGetTimestamp() - start;
+    (void)printf("%u ticks in %llu us, %u ticks suppressed, %u low power entries\n", (unsigned int)ticks,
+                 (unsigned long long)elapsed, (unsigned int)PM_FreeRTOSGetSuppressedTicks(),
+                 (unsigned int)s_enterCount);
+
+    /* The tick count never runs ahead of the time, and the suppressed ticks are compensated. */
+    if (((uint64_t)ticks * PM_FREERTOS_TICK_US) > (elapsed + (2U * PM_FREERTOS_TICK_US)))
+    {
+        (void)printf("FAIL: the tick count runs ahead of the time\n");
+        failures++;
+    }
+
+    if (((uint64_t)ticks * PM_FREERTOS_TICK_US * 10U) < (elapsed * 9U))
+    {
+        (void)printf("FAIL: the tick count lags behind the time\n");
+        failures++;
+    }
+
+    if ((PM_FreeRTOSGetSuppressedTicks() == 0U) || (s_enterCount == 0U))
+    {
+        (void)printf("FAIL: the tick was never suppressed\n");
+        failures++;
+    }
+
+    exit((failures == 0) ? 0 : 1);
+}
+
+int main(void)
+{
+    PM_CreateHandle(&s_pmHandle);
+    PM_EnablePowerManager(true);
+    PM_RegisterTimerController(&s_pmHandle, PM_PosixTimerStart, PM_PosixTimerStop, PM_PosixGetTimestamp,
+                               PM_PosixGetDuration);
+    g_devicePMOption.enter = PM_PosixEnter;
+    (void)PM_SetConstraints(PM_LP_STATE_POWER_DOWN_WAKE_PD, 0);
+
+    PM_FreeRTOSInitTickless(&s_ticklessConfig);
+    s_lastTick = PM_PosixGetTimestamp();
+
+    (void)xTaskCreate(PM_PosixTestTask, "test", configMINIMAL_STACK_SIZE, NULL, tskIDLE_PRIORITY + 1U, NULL);
+    vTaskStartScheduler();
+
+    return 1;
+}
@@ -0,0 +1,23 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+/*
+ * Host replacement of the FreeRTOS kernel headers, with the definitions used by the tickless idle adapter. The test
+ * plays the kernel: it provides eTaskConfirmSleepModeStatus() and vTaskStepTick().
+ */
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+
+#define configTICK_RATE_HZ (1000U)
+#define portMAX_DELAY      ((TickType_t)0xFFFFFFFFUL)
+
+#endif /* INC_FREERTOS_H */
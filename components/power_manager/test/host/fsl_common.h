@@ -0,0 +1,85 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_COMMON_H_
+#define _FSL_COMMON_H_
+
+/*
+ * Host replacement of the SDK fsl_common.h, with the definitions used by the power manager and the generic list.
+ * The interrupt masking functions do nothing, the tests serialize the calls themselves. The tests running the cores
+ * as threads order their accesses to the shared memory with the data memory barrier, mapped to a C11 fence.
+ */
+
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+typedef int32_t status_t;
+
+#define MAKE_STATUS(group, code) ((((group)*100L) + (code)))
+
+enum
+{
+    kStatusGroup_Generic       = 0,
+    kStatusGroup_LIST          = 142,
+    kStatusGroup_POWER_MANAGER = 159,
+};
+
+enum
+{
+    kStatus_Success              = MAKE_STATUS(kStatusGroup_Generic, 0),
+    kStatus_Fail                 = MAKE_STATUS(kStatusGroup_Generic, 1),
+    kStatus_ReadOnly             = MAKE_STATUS(kStatusGroup_Generic, 2),
+    kStatus_OutOfRange           = MAKE_STATUS(kStatusGroup_Generic, 3),
+    kStatus_InvalidArgument      = MAKE_STATUS(kStatusGroup_Generic, 4),
+    kStatus_Timeout              = MAKE_STATUS(kStatusGroup_Generic, 5),
+    kStatus_NoTransferInProgress = MAKE_STATUS(kStatusGroup_Generic, 6),
+    kStatus_Busy                 = MAKE_STATUS(kStatusGroup_Generic, 7),
+    kStatus_NoData               = MAKE_STATUS(kStatusGroup_Generic, 8),
+};
+
+#ifndef MIN
+#define MIN(a, b) (((a) < (b)) ? (a) : (b))
+#endif /* MIN */
+
+#ifndef MAX
+#define MAX(a, b) (((a) > (b)) ? (a) : (b))
+#endif /* MAX */
+
+#define __DMB() atomic_thread_fence(memory_order_seq_cst)
+
+/* Used by the wakeup source ids of fsl_pm_board.h */
+#define PORT_EFT_IRQn (0)
+#define LPTMR0_IRQn   (1)
+
+typedef struct
+{
+    uint32_t reserved;
+} CMC_Type;
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+static inline uint32_t DisableGlobalIRQ(void)
+{
+    return 0U;
+}
+
+static inline void EnableGlobalIRQ(uint32_t primask)
+{
+    (void)primask;
+}
+
+#endif /* _FSL_COMMON_H_ */
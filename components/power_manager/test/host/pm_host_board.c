@@ -0,0 +1,147 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "pm_host_board.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PM_HOST_STATE(latency, lowest0, lowest1)                                                        \
+    {                                                                                                   \
+        .exitLatency        = (latency),                                                                \
+        .fixConstraintsMask = {.rescMask = {~(lowest0), ~(lowest1)}},                                   \
+        .varConstraintsMask = {.rescMask = {(lowest0)&PM_MASK_RESC_NOT_VAR0, (lowest1)&PM_MASK_RESC_NOT_VAR1}}, \
+    }
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void PM_HostEnter(uint8_t powerState, pm_resc_mask_t *pSoftRescMask, pm_resc_group_t *pSysRescGroup);
+static void PM_HostClean(void);
+static void PM_HostTimerStart(uint64_t timeout);
+static void PM_HostTimerStop(void);
+static uint64_t PM_HostGetTimestamp(void);
+static uint64_t PM_HostGetDuration(uint64_t entryTimestamp, uint64_t exitTimestamp);
+#if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
+static status_t PM_HostManageWakeupSource(pm_wakeup_source_t *ws, bool enable);
+static bool PM_HostIsWakeupSource(pm_wakeup_source_t *ws);
+#endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+pm_device_option_t g_devicePMOption = {
+    .states =
+        {
+            PM_HOST_STATE(14U, PM_MASK_RESC_LOWEST_SLEEP0, PM_MASK_RESC_LOWEST_SLEEP1),
+            PM_HOST_STATE(14U, PM_MASK_RESC_LOWEST_DEEP_SLEEP0, PM_MASK_RESC_LOWEST_DEEP_SLEEP1),
+            PM_HOST_STATE(600U, PM_MASK_RESC_LOWEST_PDDS0, PM_MASK_RESC_LOWEST_PDDS1),
+            PM_HOST_STATE(600U, PM_MASK_RESC_LOWEST_PDPD0, PM_MASK_RESC_LOWEST_PDPD1),
+            PM_HOST_STATE(0U, PM_MASK_RESC_LOWEST_DPD0, PM_MASK_RESC_LOWEST_DPD1),
+            PM_HOST_STATE(0U, PM_MASK_RESC_LOWEST_VBAT0, PM_MASK_RESC_LOWEST_VBAT1),
+        },
+    .stateCount = PM_LP_STATE_COUNT,
+    .enter      = PM_HostEnter,
+    .clean      = PM_HostClean,
+#if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
+    .manageWakeupSource = PM_HostManageWakeupSource,
+    .isWakeupSource     = PM_HostIsWakeupSource,
+#endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
+};
+
+uint64_t g_pmHostTime;
+uint64_t g_pmHostNextEvent = PM_HOST_NO_EVENT;
+uint8_t g_pmHostLastState;
+uint32_t g_pmHostEnterCount;
+
+static uint64_t s_pmHostTimerExpiry = PM_HOST_NO_EVENT;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void PM_HostEnter(uint8_t powerState, pm_resc_mask_t *pSoftRescMask, pm_resc_group_t *pSysRescGroup)
+{
+    uint64_t wakeup = g_pmHostNextEvent;
+
+    (void)pSoftRescMask;
+    (void)pSysRescGroup;
+
+    if ((s_pmHostTimerExpiry != PM_HOST_NO_EVENT) &&
+        ((s_pmHostTimerExpiry + g_devicePMOption.states[powerState].exitLatency) < wakeup))
+    {
+        wakeup = s_pmHostTimerExpiry + g_devicePMOption.states[powerState].exitLatency;
+    }
+
+    /* Without event nor timer the device would sleep forever, the test goes on at once. */
+    if ((wakeup != PM_HOST_NO_EVENT) && (wakeup > g_pmHostTime))
+    {
+        g_pmHostTime = wakeup;
+    }
+
+    g_pmHostLastState = powerState;
+    g_pmHostEnterCount++;
+}
+
+static void PM_HostClean(void)
+{
+}
+
+static void PM_HostTimerStart(uint64_t timeout)
+{
+    /* A timeout past the end of the simulated time never expires. */
+    s_pmHostTimerExpiry = (timeout < (PM_HOST_NO_EVENT - g_pmHostTime)) ? (g_pmHostTime + timeout) : PM_HOST_NO_EVENT;
+}
+
+static void PM_HostTimerStop(void)
+{
+    s_pmHostTimerExpiry = PM_HOST_NO_EVENT;
+}
+
+static uint64_t PM_HostGetTimestamp(void)
+{
+    return g_pmHostTime;
+}
+
+static uint64_t PM_HostGetDuration(uint64_t entryTimestamp, uint64_t exitTimestamp)
+{
+    return exitTimestamp - entryTimestamp;
+}
+
+#if (defined(FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER) && FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER)
+static status_t PM_HostManageWakeupSource(pm_wakeup_source_t *ws, bool enable)
+{
+    (void)ws;
+    (void)enable;
+
+    return kStatus_Success;
+}
+
+static bool PM_HostIsWakeupSource(pm_wakeup_source_t *ws)
+{
+    (void)ws;
+
+    return false;
+}
+#endif /* FSL_PM_SUPPORT_WAKEUP_SOURCE_MANAGER */
+
+void PM_HostReset(void)
+{
+    g_pmHostTime        = 0U;
+    g_pmHostNextEvent   = PM_HOST_NO_EVENT;
+    g_pmHostLastState   = 0U;
+    g_pmHostEnterCount  = 0U;
+    s_pmHostTimerExpiry = PM_HOST_NO_EVENT;
+}
+
+void PM_HostRegisterTimer(pm_handle_t *handle)
+{
+    PM_RegisterTimerController(handle, PM_HostTimerStart, PM_HostTimerStop, PM_HostGetTimestamp, PM_HostGetDuration);
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _PM_HOST_BOARD_H_
+#define _PM_HOST_BOARD_H_
+
+#include "fsl_pm_core.h"
+#include "fsl_pm_board.h"
+
+/*!
+ * @brief Host simulation of the MCX-N9XX-EVK power states and of a low power timer counting microseconds.
+ *
+ * Entering a power state advances the simulated time to the next wakeup: the next event of the test, or the expiry
+ * of the low power timer followed by the exit latency of the state.
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief No event pending, only the low power timer wakes up the simulated device. */
+#define PM_HOST_NO_EVENT (UINT64_MAX)
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+extern pm_device_option_t g_devicePMOption; /*!< Power states, the masks are the ones of the board. */
+extern uint64_t g_pmHostTime;               /*!< Simulated time, in us. */
+extern uint64_t g_pmHostNextEvent;          /*!< Time of the next wakeup event, PM_HOST_NO_EVENT for none. */
+extern uint8_t g_pmHostLastState;           /*!< Last power state entered. */
+extern uint32_t g_pmHostEnterCount;         /*!< Number of power state entries. */
+
+/*******************************************************************************
+ * API
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*!
+ * @brief Reset the simulated time, the pending event, the low power timer and the counters.
+ */
+void PM_HostReset(void);
+
+/*!
+ * @brief Register the simulated low power timer to the power manager instance.
+ *
+ * @param handle Pointer to the power manager instance.
+ */
+void PM_HostRegisterTimer(pm_handle_t *handle);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* _PM_HOST_BOARD_H_ */
@@ -0,0 +1,257 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Publish/idle doorbell handshake of the dual-core voting, with two threads emulating the cores.
+ *
+ * Each core runs its own power manager instance on the simulated power states of the host board, the shared memory
+ * is a global variable and the doorbell an atomic flag. Entering a power state waits for the doorbell for a while, as
+ * the low power timer would end the wait. Both threads change their constraints at random and enter low power in a
+ * loop: the power state entered must be allowed by both votes, and a core idle in a power state that the vote of the
+ * other core forbids must get the doorbell.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#include "fsl_pm_multicore.h"
+#include "pm_host_board.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PM_TEST_ROUNDS (20000U)
+
+/* Yields spent in low power before the simulated timer expires, and waiting for a doorbell that must come. */
+#define PM_TEST_SLEEP_YIELDS    (200U)
+#define PM_TEST_DOORBELL_YIELDS (1000000U)
+
+#define PM_TEST_DAC0_ON PM_ENCODE_RESC(PM_RESOURCE_FULL_ON, kResc_DAC0)
+
+#define PM_TEST_CHECK(condition)                                         \
+    do                                                                   \
+    {                                                                    \
+        if (!(condition))                                                \
+        {                                                                \
+            (void)printf("FAIL: %s, line %d\n", #condition, __LINE__);  \
+            return 1;                                                    \
+        }                                                                \
+    } while (false)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+static void PM_TestNotifyPeer(uint8_t peerId);
+static void PM_TestEnter0(uint8_t powerState, pm_resc_mask_t *pSoftRescMask, pm_resc_group_t *pSysRescGroup);
+static void PM_TestEnter1(uint8_t powerState, pm_resc_mask_t *pSoftRescMask, pm_resc_group_t *pSysRescGroup);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static pm_device_option_t s_deviceOption[PM_MULTICORE_CORE_COUNT];
+static pm_handle_t s_pmHandle[PM_MULTICORE_CORE_COUNT];
+static pm_multicore_shared_t s_shared;
+static pm_multicore_handle_t s_mcHandle[PM_MULTICORE_CORE_COUNT];
+
+static const pm_multicore_config_t s_mcConfig[PM_MULTICORE_CORE_COUNT] = {
+    {.handle = &s_pmHandle[0], .shared = &s_shared, .coreId = 0U, .notifyPeer = PM_TestNotifyPeer},
+    {.handle = &s_pmHandle[1], .shared = &s_shared, .coreId = 1U, .notifyPeer = PM_TestNotifyPeer},
+};
+
+static atomic_bool s_doorbell[PM_MULTICORE_CORE_COUNT];
+static uint8_t s_lastState[PM_MULTICORE_CORE_COUNT];
+static bool s_threaded;
+
+/* Called once from the next low power entry of core0, while core0 is idle. */
+static void (*s_core0IdleHook)(void);
+
+static uint32_t s_disallowedCount[PM_MULTICORE_CORE_COUNT];
+static uint32_t s_missedCount[PM_MULTICORE_CORE_COUNT];
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static void PM_TestNotifyPeer(uint8_t peerId)
+{
+    atomic_store(&s_doorbell[peerId], true);
+}
+
+/* Wait for the doorbell for at most yields, return whether it was raised. */
+static bool PM_TestWaitDoorbell(uint8_t coreId, uint32_t yields)
+{
+    uint32_t i;
+
+    for (i = 0U; (i < yields) && !atomic_load(&s_doorbell[coreId]); i++)
+    {
+        (void)sched_yield();
+    }
+
+    return atomic_load(&s_doorbell[coreId]);
+}
+
+/* Deepest power state allowed by the stable vote of a core, 0xFF while the vote is being written. */
+static uint8_t PM_TestReadVote(const pm_multicore_vote_t *vote)
+{
+    uint32_t sequence = vote->sequence;
+    uint8_t powerMode;
+
+    __DMB();
+    powerMode = vote->powerModeConstraint;
+    __DMB();
+
+    return (((sequence & 1U) == 0U) && (sequence == vote->sequence)) ? powerMode : 0xFFU;
+}
+
+static void PM_TestEnter(uint8_t coreId, uint8_t powerState)
+{
+    uint8_t peerVote;
+    void (*hook)(void);
+
+    s_lastState[coreId] = powerState;
+
+    /* The power state is allowed by both votes. */
+    if ((powerState > s_mcHandle[coreId].peerPowerMode) || (powerState > s_shared.votes[coreId].powerModeConstraint))
+    {
+        s_disallowedCount[coreId]++;
+    }
+
+    if ((coreId == 0U) && (s_core0IdleHook != NULL))
+    {
+        hook            = s_core0IdleHook;
+        s_core0IdleHook = NULL;
+        hook();
+    }
+
+    if (s_threaded && !PM_TestWaitDoorbell(coreId, PM_TEST_SLEEP_YIELDS))
+    {
+        /* The timer expired. A vote of the other core forbidding this power state must ring the doorbell. */
+        peerVote = PM_TestReadVote(&s_shared.votes[coreId ^ 1U]);
+        if ((peerVote < powerState) && !PM_TestWaitDoorbell(coreId, PM_TEST_DOORBELL_YIELDS))
+        {
+            s_missedCount[coreId]++;
+        }
+    }
+}
+
+static void PM_TestEnter0(uint8_t powerState, pm_resc_mask_t *pSoftRescMask, pm_resc_group_t *pSysRescGroup)
+{
+    PM_TestEnter(0U, powerState);
+}
+
+static void PM_TestEnter1(uint8_t powerState, pm_resc_mask_t *pSoftRescMask, pm_resc_group_t *pSysRescGroup)
+{
+    PM_TestEnter(1U, powerState);
+}
+
+static void PM_TestTightenFromCore1(void)
+{
+    (void)PM_SetConstraintsByHandle(&s_pmHandle[1], PM_LP_STATE_SLEEP, 0);
+    PM_MulticorePublish(&s_mcHandle[1]);
+}
+
+static void PM_TestLoosenFromCore1(void)
+{
+    (void)PM_ReleaseConstraintsByHandle(&s_pmHandle[1], PM_LP_STATE_SLEEP, 0);
+    PM_MulticorePublish(&s_mcHandle[1]);
+}
+
+static void *PM_TestCore(void *param)
+{
+    uint8_t coreId = (uint8_t)(uintptr_t)param;
+    uint32_t random = 12345U * ((uint32_t)coreId + 1U);
+    uint8_t powerMode;
+    int32_t rescNum;
+    uint32_t i;
+
+    for (i = 0U; i < PM_TEST_ROUNDS; i++)
+    {
+        random    = (random * 1103515245U) + 12345U;
+        powerMode = (uint8_t)((random >> 16U) % PM_LP_STATE_COUNT);
+        rescNum   = (int32_t)((random >> 8U) & 1U);
+
+        (void)PM_SetConstraintsByHandle(&s_pmHandle[coreId], powerMode, rescNum, PM_TEST_DAC0_ON);
+        if (((random >> 4U) & 1U) != 0U)
+        {
+            PM_MulticorePublish(&s_mcHandle[coreId]);
+        }
+
+        atomic_store(&s_doorbell[coreId], false);
+        PM_MulticoreEnterLowPower(&s_mcHandle[coreId], 0U);
+        (void)PM_ReleaseConstraintsByHandle(&s_pmHandle[coreId], powerMode, rescNum, PM_TEST_DAC0_ON);
+    }
+
+    return NULL;
+}
+
+int main(void)
+{
+    static void (*const s_enter[PM_MULTICORE_CORE_COUNT])(uint8_t, pm_resc_mask_t *, pm_resc_group_t *) = {
+        PM_TestEnter0, PM_TestEnter1};
+    pthread_t thread[PM_MULTICORE_CORE_COUNT];
+    uint8_t deepest = PM_LP_STATE_COUNT - 1U;
+    uint8_t i;
+
+    for (i = 0U; i < PM_MULTICORE_CORE_COUNT; i++)
+    {
+        s_deviceOption[i]       = g_devicePMOption;
+        s_deviceOption[i].enter = s_enter[i];
+        PM_InitHandle(&s_pmHandle[i], &s_deviceOption[i]);
+        PM_EnablePowerManagerByHandle(&s_pmHandle[i], true);
+    }
+
+    PM_MulticoreInitShared(&s_shared);
+    PM_TEST_CHECK(PM_MulticoreInit(&s_mcHandle[0], &s_mcConfig[0]) == kStatus_PMSuccess);
+
+    /* Until core1 has voted, core0 only enters the first power state. */
+    PM_MulticoreEnterLowPower(&s_mcHandle[0], 0U);
+    PM_TEST_CHECK(s_lastState[0] == 0U);
+    PM_TEST_CHECK(PM_MulticoreInit(&s_mcHandle[1], &s_mcConfig[1]) == kStatus_PMSuccess);
+    PM_MulticoreEnterLowPower(&s_mcHandle[0], 0U);
+    PM_TEST_CHECK(s_lastState[0] == deepest);
+
+    /* A vote tightened while core0 is idle rings the doorbell, the vote is applied once core0 woke up. */
+    s_core0IdleHook = PM_TestTightenFromCore1;
+    PM_MulticoreEnterLowPower(&s_mcHandle[0], 0U);
+    PM_TEST_CHECK(atomic_load(&s_doorbell[0]) && PM_MulticoreIsVoteApplied(&s_mcHandle[1]));
+    atomic_store(&s_doorbell[0], false);
+    PM_MulticoreEnterLowPower(&s_mcHandle[0], 0U);
+    PM_TEST_CHECK(s_lastState[0] == PM_LP_STATE_SLEEP);
+
+    /* A vote loosened while it limits the idle core0 rings the doorbell too. */
+    s_core0IdleHook = PM_TestLoosenFromCore1;
+    PM_MulticoreEnterLowPower(&s_mcHandle[0], 0U);
+    PM_TEST_CHECK(atomic_load(&s_doorbell[0]));
+    atomic_store(&s_doorbell[0], false);
+
+    /* Both cores concurrently. */
+    s_threaded = true;
+    for (i = 0U; i < PM_MULTICORE_CORE_COUNT; i++)
+    {
+        PM_TEST_CHECK(pthread_create(&thread[i], NULL, PM_TestCore, (void *)(uintptr_t)i) == 0);
+    }
+    for (i = 0U; i < PM_MULTICORE_CORE_COUNT; i++)
+    {
+        (void)pthread_join(thread[i], NULL);
+    }
+
+    (void)printf("doorbells %u %u\n", (unsigned int)s_mcHandle[0].doorbellCount,
+                 (unsigned int)s_mcHandle[1].doorbellCount);
+    for (i = 0U; i < PM_MULTICORE_CORE_COUNT; i++)
+    {
+        PM_TEST_CHECK(s_disallowedCount[i] == 0U);
+        PM_TEST_CHECK(s_missedCount[i] == 0U);
+        PM_TEST_CHECK(!s_shared.votes[i].idle);
+        PM_TEST_CHECK(PM_GetAllowedLowestPowerModeByHandle(&s_pmHandle[i]) == deepest);
+    }
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Fallback of the entry notifiers, with the state masks.
+ *
+ * The notifiers log their callbacks: an upper case letter and the state on entry, a lower case letter and the state
+ * on exit. When a notifier falls back to a shallower state, the notifiers skipped for the deeper state must be called
+ * for the shallower one if their mask has it, and every notifier called on entry must get its exit callback with the
+ * state it was given on entry.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pm_host_board.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PM_TEST_CHECK(condition)                                                           \
+    do                                                                                     \
+    {                                                                                      \
+        if (!(condition))                                                                  \
+        {                                                                                  \
+            (void)printf("FAIL: %s, line %d, log \"%s\"\n", #condition, __LINE__, s_log); \
+            return 1;                                                                      \
+        }                                                                                  \
+    } while (false)
+
+/*! @brief Notifier of the test, returning vetoStatus on entry in the states deeper than vetoState. */
+typedef struct _pm_test_notifier
+{
+    char name;
+    uint8_t vetoState;
+    status_t vetoStatus;
+} pm_test_notifier_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static pm_handle_t s_pmHandle;
+static char s_log[128];
+static size_t s_logLength;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static status_t PM_TestNotify(pm_event_type_t eventType, uint8_t powerState, void *data)
+{
+    pm_test_notifier_t *notifier = (pm_test_notifier_t *)data;
+    status_t status              = kStatus_Success;
+    char name                    = notifier->name;
+
+    if (eventType == kPM_EventEnteringSleep)
+    {
+        name = (char)(name - 'a' + 'A');
+        if (powerState > notifier->vetoState)
+        {
+            status = notifier->vetoStatus;
+        }
+    }
+
+    s_logLength += (size_t)snprintf(&s_log[s_logLength], sizeof(s_log) - s_logLength, "%c%u ", name,
+                                    (unsigned int)powerState);
+
+    return status;
+}
+
+/* Enter low power with the given notifiers registered in group0 in this order, return the state entered or -1. */
+static int PM_TestEnter(pm_notify_element_t *elements, uint32_t count)
+{
+    uint32_t enterCount;
+    uint32_t i;
+
+    PM_HostReset();
+    PM_CreateHandle(&s_pmHandle);
+    PM_EnablePowerManager(true);
+    for (i = 0U; i < count; i++)
+    {
+        (void)PM_RegisterNotify(kPM_NotifyGroup0, &elements[i]);
+    }
+    (void)PM_SetConstraints(PM_LP_STATE_POWER_DOWN_WAKE_PD, 0);
+
+    s_log[0]    = '\0';
+    s_logLength = 0U;
+    enterCount  = g_pmHostEnterCount;
+    PM_EnterLowPower(0U);
+
+    return (g_pmHostEnterCount != enterCount) ? (int)g_pmHostLastState : -1;
+}
+
+int main(void)
+{
+    pm_test_notifier_t a = {'a', PM_LP_STATE_COUNT, kStatus_Success};
+    pm_test_notifier_t b = {'b', PM_LP_STATE_DEEP_SLEEP, PM_NOTIFY_FALLBACK(PM_LP_STATE_DEEP_SLEEP)};
+    pm_test_notifier_t c = {'c', PM_LP_STATE_COUNT, kStatus_Success};
+    pm_notify_element_t elements[3];
+
+    /* A skipped for Power Down is called for the Deep Sleep fallback of B. */
+    elements[0] = (pm_notify_element_t){.notifyCallback = PM_TestNotify,
+                                        .data           = &a,
+                                        .stateMask      = PM_NOTIFY_STATE(PM_LP_STATE_DEEP_SLEEP)};
+    elements[1] = (pm_notify_element_t){.notifyCallback = PM_TestNotify, .data = &b};
+    PM_TEST_CHECK(PM_TestEnter(elements, 2U) == PM_LP_STATE_DEEP_SLEEP);
+    PM_TEST_CHECK(strcmp(s_log, "B3 B1 A1 a1 b1 ") == 0);
+
+    /* B is not called again for Deep Sleep, out of its mask, but gets the exit of the Power Down it was called for. */
+    elements[0] = (pm_notify_element_t){.notifyCallback = PM_TestNotify,
+                                        .data           = &a,
+                                        .stateMask      = PM_NOTIFY_STATE(PM_LP_STATE_DEEP_SLEEP)};
+    elements[1] = (pm_notify_element_t){
+        .notifyCallback = PM_TestNotify, .data = &b, .stateMask = PM_NOTIFY_STATES_FROM(PM_LP_STATE_POWER_DOWN_WAKE_DS)};
+    PM_TEST_CHECK(PM_TestEnter(elements, 2U) == PM_LP_STATE_DEEP_SLEEP);
+    PM_TEST_CHECK(strcmp(s_log, "B3 A1 a1 b3 ") == 0);
+
+    /* A called for the fallback falls back further to Sleep, C skipped until then is called for Sleep. */
+    a.vetoState  = PM_LP_STATE_SLEEP;
+    a.vetoStatus = PM_NOTIFY_FALLBACK(PM_LP_STATE_SLEEP);
+    elements[0]  = (pm_notify_element_t){
+        .notifyCallback = PM_TestNotify, .data = &c, .stateMask = PM_NOTIFY_STATE(PM_LP_STATE_SLEEP)};
+    elements[1] = (pm_notify_element_t){.notifyCallback = PM_TestNotify,
+                                        .data           = &a,
+                                        .stateMask      = PM_NOTIFY_STATE(PM_LP_STATE_DEEP_SLEEP)};
+    elements[2] = (pm_notify_element_t){.notifyCallback = PM_TestNotify, .data = &b};
+    PM_TEST_CHECK(PM_TestEnter(elements, 3U) == PM_LP_STATE_SLEEP);
+    PM_TEST_CHECK(strcmp(s_log, "B3 B1 A1 C0 c0 a1 b1 ") == 0);
+
+    /* A called for the fallback fails: no entry, the notifiers called get their exit callback. */
+    a.vetoStatus = kStatus_Fail;
+    elements[0]  = (pm_notify_element_t){.notifyCallback = PM_TestNotify,
+                                        .data           = &a,
+                                        .stateMask      = PM_NOTIFY_STATE(PM_LP_STATE_DEEP_SLEEP)};
+    elements[1]  = (pm_notify_element_t){.notifyCallback = PM_TestNotify, .data = &b};
+    PM_TEST_CHECK(PM_TestEnter(elements, 2U) == -1);
+    PM_TEST_CHECK(strcmp(s_log, "B3 B1 A1 a1 b1 ") == 0);
+
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Host simulation of PM_GovernorDeepestAllowed() and PM_GovernorLadder() on synthetic wakeup traces.
+ *
+ * The device may enter up to Power Down with CORE_WAKE in Power Down. Each wakeup is a timer event known in advance,
+ * the duration given to PM_EnterLowPower() is the time until it. The energy of each entry is the residency times the
+ * power of the state, plus the transition energy of the state. With the power figures below, the break-even time of
+ * the Power Down states against Deep Sleep is 21600 / (20 - 2) = 1200 us.
+ */
+
+#include <stdio.h>
+
+#include "pm_host_board.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+#define PM_SIM_BREAK_EVEN_TIME (1200U)
+
+/*! @brief Segment of a trace, count wakeups period us apart. */
+typedef struct _pm_sim_segment
+{
+    uint32_t period;
+    uint32_t count;
+} pm_sim_segment_t;
+
+typedef struct _pm_sim_trace
+{
+    const char *name;
+    const pm_sim_segment_t *segments;
+    uint32_t segmentCount;
+    uint32_t repeat;
+} pm_sim_trace_t;
+
+typedef struct _pm_sim_result
+{
+    double energy;
+    uint32_t powerDownCount;
+} pm_sim_result_t;
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+
+static pm_handle_t s_pmHandle;
+
+/* Relative power of each state, and energy of a transition through it. */
+static const double s_statePower[PM_LP_STATE_COUNT]      = {100.0, 20.0, 2.0, 2.0, 1.0, 1.0};
+static const double s_stateTransition[PM_LP_STATE_COUNT] = {0.0, 0.0, 21600.0, 21600.0, 0.0, 0.0};
+
+static const pm_sim_segment_t s_periodicShort[] = {{1000U, 5000U}};
+static const pm_sim_segment_t s_periodicLong[]  = {{10000U, 1000U}};
+/* Bursts of wakeups every 1 ms, then quiet periods with wakeups every 10 ms. */
+static const pm_sim_segment_t s_bursty[] = {{1000U, 500U}, {10000U, 50U}};
+
+static const pm_sim_trace_t s_traces[] = {
+    {"periodic 1 ms", s_periodicShort, 1U, 1U},
+    {"periodic 10 ms", s_periodicLong, 1U, 1U},
+    {"bursty", s_bursty, 2U, 20U},
+};
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+static pm_sim_result_t PM_SimRun(const pm_sim_trace_t *trace, pm_governor_func_t governor)
+{
+    pm_sim_result_t result = {0.0, 0U};
+    uint64_t entry;
+    uint32_t i;
+    uint32_t j;
+    uint32_t k;
+
+    PM_HostReset();
+    PM_CreateHandle(&s_pmHandle);
+    PM_EnablePowerManager(true);
+    PM_HostRegisterTimer(&s_pmHandle);
+    PM_RegisterGovernor(&s_pmHandle, governor);
+    (void)PM_SetConstraints(PM_LP_STATE_POWER_DOWN_WAKE_PD, 0);
+
+    for (i = 0U; i < trace->repeat; i++)
+    {
+        for (j = 0U; j < trace->segmentCount; j++)
+        {
+            for (k = 0U; k < trace->segments[j].count; k++)
+            {
+                entry             = g_pmHostTime;
+                g_pmHostNextEvent = entry + trace->segments[j].period;
+                PM_EnterLowPower(trace->segments[j].period);
+
+                result.energy += (s_statePower[g_pmHostLastState] * (double)(g_pmHostTime - entry)) +
+                                 s_stateTransition[g_pmHostLastState];
+                if (g_pmHostLastState >= PM_LP_STATE_POWER_DOWN_WAKE_DS)
+                {
+                    result.powerDownCount++;
+                }
+            }
+        }
+    }
+
+    (void)PM_ReleaseConstraints(PM_LP_STATE_POWER_DOWN_WAKE_PD, 0);
+
+    return result;
+}
+
+int main(void)
+{
+    pm_sim_result_t deepest[sizeof(s_traces) / sizeof(s_traces[0])];
+    pm_sim_result_t ladder[sizeof(s_traces) / sizeof(s_traces[0])];
+    int failures = 0;
+    uint32_t i;
+
+    g_devicePMOption.states[PM_LP_STATE_POWER_DOWN_WAKE_DS].breakEvenTime = PM_SIM_BREAK_EVEN_TIME;
+    g_devicePMOption.states[PM_LP_STATE_POWER_DOWN_WAKE_PD].breakEvenTime = PM_SIM_BREAK_EVEN_TIME;
+
+    (void)printf("%-16s %-8s %14s %12s\n", "trace", "governor", "energy", "power downs");
+    for (i = 0U; i < sizeof(s_traces) / sizeof(s_traces[0]); i++)
+    {
+        deepest[i] = PM_SimRun(&s_traces[i], PM_GovernorDeepestAllowed);
+        ladder[i]  = PM_SimRun(&s_traces[i], PM_GovernorLadder);
+
+        (void)printf("%-16s %-8s %14.0f %12u\n", s_traces[i].name, "deepest", deepest[i].energy,
+                     deepest[i].powerDownCount);
+        (void)printf("%-16s %-8s %14.0f %12u  %+.1f%%\n", s_traces[i].name, "ladder", ladder[i].energy,
+                     ladder[i].powerDownCount, 100.0 * (ladder[i].energy - deepest[i].energy) / deepest[i].energy);
+    }
+
+    /* Under the break-even time, only the first entry without history goes to Power Down. */
+    if ((ladder[0].powerDownCount > 1U) || (ladder[0].energy >= deepest[0].energy))
+    {
+        (void)printf("FAIL: the ladder enters Power Down under the break-even time\n");
+        failures++;
+    }
+
+    /* Over the break-even time, the ladder only spends its climb in the shallower states. */
+    if ((ladder[1].powerDownCount + (PM_GOVERNOR_LADDER_PROMOTE_COUNT * PM_LP_STATE_POWER_DOWN_WAKE_DS) + 1U) <
+        deepest[1].powerDownCount)
+    {
+        (void)printf("FAIL: the ladder does not settle in Power Down over the break-even time\n");
+        failures++;
+    }
+
+    if (ladder[2].energy >= deepest[2].energy)
+    {
+        (void)printf("FAIL: the ladder saves no energy on the bursty trace\n");
+        failures++;
+    }
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_pm_lptmr.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+typedef struct _pm_lptmr_state
+{
+    LPTMR_Type *base;
+    IRQn_Type irq;
+    lptmr_prescaler_clock_select_t clockSource;
+    bool running;
+    bool expired;        /*!< The last period elapsed and was not yet reported by PM_LptmrHandleIRQ(). */
+    uint8_t shift;       /*!< Prescaler as a power of 2 of the input clock, 0 when bypassed. */
+    uint32_t period;     /*!< Compare period in prescaled ticks. */
+    uint32_t periodCount;
+    uint32_t periodsDone;
+    uint64_t elapsed;    /*!< Input clock ticks elapsed until the last stop. */
+} pm_lptmr_state_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint64_t PM_LptmrCountElapsed(void);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static LPTMR_Type *const s_pmLptmrBases[] = LPTMR_BASE_PTRS;
+static const IRQn_Type s_pmLptmrIrqs[]    = LPTMR_IRQS;
+
+static pm_lptmr_state_t s_pmLptmr;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Count the input clock ticks elapsed since the timer was started.
+ *
+ * A compare flag set but not yet counted means that the counter was reset by the end of a period, the counter is then
+ * read again to get a value from the new period.
+ */
+static uint64_t PM_LptmrCountElapsed(void)
+{
+    uint32_t count       = LPTMR_GetCurrentTimerCount(s_pmLptmr.base);
+    uint64_t periodsDone = (uint64_t)s_pmLptmr.periodsDone;
+
+    if ((LPTMR_GetStatusFlags(s_pmLptmr.base) & (uint32_t)kLPTMR_TimerCompareFlag) != 0U)
+    {
+        periodsDone++;
+        count = LPTMR_GetCurrentTimerCount(s_pmLptmr.base);
+    }
+
+    return ((periodsDone * (uint64_t)s_pmLptmr.period) + (uint64_t)count) << s_pmLptmr.shift;
+}
+
+/*!
+ * brief Initialize the LPTMR used as low power timer.
+ *
+ * The input clock selected by clockSource must be enabled before starting the timer.
+ *
+ * param base LPTMR peripheral base address.
+ * param clockSource Prescaler clock of the LPTMR.
+ */
+void PM_LptmrInit(LPTMR_Type *base, lptmr_prescaler_clock_select_t clockSource)
+{
+    uint32_t instance;
+
+    assert(base != NULL);
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_pmLptmrBases); instance++)
+    {
+        if (s_pmLptmrBases[instance] == base)
+        {
+            break;
+        }
+    }
+    assert(instance < ARRAY_SIZE(s_pmLptmrBases));
+
+    (void)memset(&s_pmLptmr, 0, sizeof(s_pmLptmr));
+    s_pmLptmr.base        = base;
+    s_pmLptmr.irq         = s_pmLptmrIrqs[instance];
+    s_pmLptmr.clockSource = clockSource;
+}
+
+/*!
+ * brief Start the low power timer.
+ *
+ * Matches pm_low_power_timer_start_func_t.
+ *
+ * param timeout Duration in ticks of the LPTMR input clock, 0 is handled as 1.
+ */
+void PM_LptmrStart(uint64_t timeout)
+{
+    lptmr_config_t config;
+    uint64_t ticks;
+    uint64_t periodCount = 1U;
+    uint8_t shift        = 0U;
+
+    assert(s_pmLptmr.base != NULL);
+
+    /* Finest resolution that covers the duration in one period, the counter is never late: ticks are rounded down. */
+    while (((timeout >> shift) > PM_LPTMR_MAX_PERIOD) && (shift < PM_LPTMR_MAX_PRESCALER_SHIFT))
+    {
+        shift++;
+    }
+    ticks = timeout >> shift;
+    if (ticks == 0U)
+    {
+        ticks = 1U;
+    }
+
+    /* Beyond the largest prescaler, split the duration in equal periods. */
+    if (ticks > PM_LPTMR_MAX_PERIOD)
+    {
+        periodCount = (ticks + PM_LPTMR_MAX_PERIOD - 1U) / PM_LPTMR_MAX_PERIOD;
+        ticks       = ticks / periodCount;
+    }
+
+    LPTMR_GetDefaultConfig(&config);
+    config.prescalerClockSource = s_pmLptmr.clockSource;
+    config.bypassPrescaler      = (shift == 0U);
+    config.value =
+        (shift == 0U) ? kLPTMR_Prescale_Glitch_0 : (lptmr_prescaler_glitch_value_t)(uint32_t)(shift - 1U);
+
+    LPTMR_Init(s_pmLptmr.base, &config);
+    LPTMR_SetTimerPeriod(s_pmLptmr.base, (uint32_t)ticks);
+
+    s_pmLptmr.shift       = shift;
+    s_pmLptmr.period      = (uint32_t)ticks;
+    s_pmLptmr.periodCount = (uint32_t)periodCount;
+    s_pmLptmr.periodsDone = 0U;
+    s_pmLptmr.expired     = false;
+    s_pmLptmr.running     = true;
+
+    LPTMR_EnableInterrupts(s_pmLptmr.base, (uint32_t)kLPTMR_TimerInterruptEnable);
+    LPTMR_StartTimer(s_pmLptmr.base);
+}
+
+/*!
+ * brief Stop the low power timer.
+ *
+ * Matches pm_low_power_timer_stop_func_t. The elapsed time is kept for PM_LptmrGetElapsedTicks().
+ */
+void PM_LptmrStop(void)
+{
+    assert(s_pmLptmr.base != NULL);
+
+    if (s_pmLptmr.running)
+    {
+        s_pmLptmr.elapsed = PM_LptmrCountElapsed();
+
+        /* Stopping the timer clears the compare flag, remember that the timeout expired for PM_LptmrHandleIRQ(). */
+        if ((LPTMR_GetStatusFlags(s_pmLptmr.base) & (uint32_t)kLPTMR_TimerCompareFlag) != 0U)
+        {
+            s_pmLptmr.periodsDone++;
+            if (s_pmLptmr.periodsDone >= s_pmLptmr.periodCount)
+            {
+                s_pmLptmr.expired = true;
+            }
+        }
+
+        s_pmLptmr.running = false;
+    }
+
+    LPTMR_DisableInterrupts(s_pmLptmr.base, (uint32_t)kLPTMR_TimerInterruptEnable);
+    LPTMR_StopTimer(s_pmLptmr.base);
+}
+
+/*!
+ * brief Re-arm the low power timer after an intermediate compare period.
+ *
+ * Matches pm_low_power_timer_rearm_func_t, called by the power manager with the interrupts masked after each wakeup.
+ *
+ * retval true The wakeup was caused by an intermediate period, the timer is running and its interrupt is cleared.
+ * retval false The timeout expired, or the device was woken up by another source.
+ */
+bool PM_LptmrRearm(void)
+{
+    bool rearmed = false;
+
+    if (s_pmLptmr.running &&
+        ((LPTMR_GetStatusFlags(s_pmLptmr.base) & (uint32_t)kLPTMR_TimerCompareFlag) != 0U) &&
+        ((s_pmLptmr.periodsDone + 1U) < s_pmLptmr.periodCount))
+    {
+        /* The counter restarted from 0 on the compare, only the flag and the pending interrupt are cleared. */
+        LPTMR_ClearStatusFlags(s_pmLptmr.base, (uint32_t)kLPTMR_TimerCompareFlag);
+        NVIC_ClearPendingIRQ(s_pmLptmr.irq);
+        s_pmLptmr.periodsDone++;
+        rearmed = true;
+    }
+
+    return rearmed;
+}
+
+/*!
+ * brief Handle the LPTMR interrupt.
+ *
+ * To be called from the LPTMR interrupt handler. Intermediate periods are counted and cleared.
+ *
+ * retval true The timeout expired since the last call, the wakeup source service should be triggered.
+ * retval false The interrupt was an intermediate period.
+ */
+bool PM_LptmrHandleIRQ(void)
+{
+    bool expired;
+
+    if ((LPTMR_GetStatusFlags(s_pmLptmr.base) & (uint32_t)kLPTMR_TimerCompareFlag) != 0U)
+    {
+        LPTMR_ClearStatusFlags(s_pmLptmr.base, (uint32_t)kLPTMR_TimerCompareFlag);
+        s_pmLptmr.periodsDone++;
+        if (s_pmLptmr.periodsDone >= s_pmLptmr.periodCount)
+        {
+            s_pmLptmr.expired = true;
+        }
+    }
+
+    expired           = s_pmLptmr.expired;
+    s_pmLptmr.expired = false;
+
+    return expired;
+}
+
+/*!
+ * brief Get the time elapsed since the low power timer was started.
+ *
+ * While the timer runs, the time elapsed so far. Once stopped, the time elapsed until PM_LptmrStop(), which gives the
+ * actual low power duration when another wakeup source ended it early.
+ *
+ * return Elapsed time in ticks of the LPTMR input clock, with the resolution of the prescaler used.
+ */
+uint64_t PM_LptmrGetElapsedTicks(void)
+{
+    return s_pmLptmr.running ? PM_LptmrCountElapsed() : s_pmLptmr.elapsed;
+}
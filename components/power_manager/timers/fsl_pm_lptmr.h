@@ -0,0 +1,127 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_PM_LPTMR_H_
+#define _FSL_PM_LPTMR_H_
+
+#include "fsl_common.h"
+#include "fsl_lptmr.h"
+
+/*!
+ * @addtogroup PM Framework: Power Manager Framework
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @name LPTMR low power timer
+ *
+ * Low power timer of the timer controller built on the LPTMR, to be registered with PM_RegisterTimerController() and
+ * PM_RegisterTimerRearm():
+ * @code
+ * PM_LptmrInit(LPTMR0, kLPTMR_PrescalerClock_1);
+ * PM_RegisterTimerController(&g_pmHandle, PM_LptmrStart, PM_LptmrStop, NULL, NULL);
+ * PM_RegisterTimerRearm(&g_pmHandle, PM_LptmrRearm);
+ *
+ * void LPTMR0_IRQHandler(void)
+ * {
+ *     if (PM_LptmrHandleIRQ())
+ *     {
+ *         PM_TriggerWakeSourceService(&g_lptmr0WakeupSource);
+ *     }
+ * }
+ * @endcode
+ * The durations are in ticks of the LPTMR input clock. The prescaler is chosen for each duration: the finest
+ * resolution that covers the duration in one compare period. Longer durations are split in equal compare periods,
+ * the intermediate wakeups are absorbed by PM_LptmrRearm() and the application only wakes up at the end.
+ * @{
+ */
+
+/*! @brief Largest prescaler of the LPTMR, as a power of 2 of the input clock. */
+#define PM_LPTMR_MAX_PRESCALER_SHIFT (16U)
+
+/*! @brief Number of counter ticks in the longest compare period. */
+#define PM_LPTMR_MAX_PERIOD ((uint64_t)LPTMR_CMR_COMPARE_MASK)
+
+/*! @} */
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initialize the LPTMR used as low power timer.
+ *
+ * The input clock selected by clockSource must be enabled before starting the timer.
+ *
+ * @param base LPTMR peripheral base address.
+ * @param clockSource Prescaler clock of the LPTMR.
+ */
+void PM_LptmrInit(LPTMR_Type *base, lptmr_prescaler_clock_select_t clockSource);
+
+/*!
+ * @brief Start the low power timer.
+ *
+ * Matches pm_low_power_timer_start_func_t.
+ *
+ * @param timeout Duration in ticks of the LPTMR input clock, 0 is handled as 1.
+ */
+void PM_LptmrStart(uint64_t timeout);
+
+/*!
+ * @brief Stop the low power timer.
+ *
+ * Matches pm_low_power_timer_stop_func_t. The elapsed time is kept for PM_LptmrGetElapsedTicks().
+ */
+void PM_LptmrStop(void);
+
+/*!
+ * @brief Re-arm the low power timer after an intermediate compare period.
+ *
+ * Matches pm_low_power_timer_rearm_func_t, called by the power manager with the interrupts masked after each wakeup.
+ *
+ * @retval true The wakeup was caused by an intermediate period, the timer is running and its interrupt is cleared.
+ * @retval false The timeout expired, or the device was woken up by another source.
+ */
+bool PM_LptmrRearm(void);
+
+/*!
+ * @brief Handle the LPTMR interrupt.
+ *
+ * To be called from the LPTMR interrupt handler. Intermediate periods are counted and cleared.
+ *
+ * @retval true The timeout expired since the last call, the wakeup source service should be triggered.
+ * @retval false The interrupt was an intermediate period.
+ */
+bool PM_LptmrHandleIRQ(void);
+
+/*!
+ * @brief Get the time elapsed since the low power timer was started.
+ *
+ * While the timer runs, the time elapsed so far. Once stopped, the time elapsed until PM_LptmrStop(), which gives the
+ * actual low power duration when another wakeup source ended it early.
+ *
+ * @return Elapsed time in ticks of the LPTMR input clock, with the resolution of the prescaler used.
+ */
+uint64_t PM_LptmrGetElapsedTicks(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*!
+ * @}
+ */
+
+#endif /* _FSL_PM_LPTMR_H_ */
@@ -0,0 +1,207 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_pm_ostimer.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define PM_OSTIMER_US_PER_SECOND (1000000ULL)
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint64_t PM_OstimerReadCounter(void);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static OSTIMER_Type *const s_pmOstimerBases[] = OSTIMER_BASE_PTRS;
+static const IRQn_Type s_pmOstimerIrqs[]    = OSTIMER_IRQS;
+
+static OSTIMER_Type *s_pmOstimerBase;
+static IRQn_Type s_pmOstimerIrq;
+static uint32_t s_pmOstimerFreq;
+static ostimer_callback_t s_pmOstimerAlarmCallback;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Read the gray-coded event counter.
+ *
+ * Gray code protects each half of the counter from a torn read, the high half is read again to detect that the low
+ * half wrapped between the two accesses.
+ *
+ * @return The gray-coded counter value.
+ */
+static uint64_t PM_OstimerReadCounter(void)
+{
+    uint32_t high;
+    uint32_t low;
+
+    do
+    {
+        high = s_pmOstimerBase->EVTIMERH;
+        low  = s_pmOstimerBase->EVTIMERL;
+    } while (high != s_pmOstimerBase->EVTIMERH);
+
+    return ((uint64_t)high << 32U) | (uint64_t)low;
+}
+
+/*!
+ * brief Initialize the OSTIMER used as timestamp provider.
+ *
+ * The OSTIMER clock source must be attached before calling this function.
+ *
+ * param base OSTIMER peripheral base address.
+ * param clockFreq Frequency of the OSTIMER clock in Hz, must not be 0.
+ */
+void PM_OstimerInit(OSTIMER_Type *base, uint32_t clockFreq)
+{
+    uint32_t instance;
+
+    assert(base != NULL);
+    assert(clockFreq != 0U);
+
+    for (instance = 0U; instance < ARRAY_SIZE(s_pmOstimerBases); instance++)
+    {
+        if (s_pmOstimerBases[instance] == base)
+        {
+            break;
+        }
+    }
+    assert(instance < ARRAY_SIZE(s_pmOstimerBases));
+
+    OSTIMER_Init(base);
+    s_pmOstimerBase = base;
+    s_pmOstimerIrq  = s_pmOstimerIrqs[instance];
+    s_pmOstimerFreq = clockFreq;
+}
+
+/*!
+ * brief Get the current OSTIMER timestamp.
+ *
+ * Matches pm_low_power_timer_get_timestamp_func_t.
+ *
+ * return The counter value in ticks, only the bits of PM_OSTIMER_COUNTER_MASK are used.
+ */
+uint64_t PM_OstimerGetTimestamp(void)
+{
+    assert(s_pmOstimerBase != NULL);
+
+    return PM_OstimerGrayToBinary(PM_OstimerReadCounter()) & PM_OSTIMER_COUNTER_MASK;
+}
+
+/*!
+ * brief Get the time elapsed between two OSTIMER timestamps.
+ *
+ * Matches pm_low_power_timer_get_duration_func_t. The result is correct across a wrap of the counter as long as the
+ * interval is shorter than 2^42 ticks.
+ *
+ * param entryTimestamp The earlier timestamp.
+ * param exitTimestamp The later timestamp.
+ * return The elapsed time in microseconds.
+ */
+uint64_t PM_OstimerGetDuration(uint64_t entryTimestamp, uint64_t exitTimestamp)
+{
+    return PM_OstimerTicksToUs((exitTimestamp - entryTimestamp) & PM_OSTIMER_COUNTER_MASK);
+}
+
+/*!
+ * brief Convert OSTIMER ticks to microseconds.
+ *
+ * param ticks Number of ticks.
+ * return The number of microseconds, rounded down.
+ */
+uint64_t PM_OstimerTicksToUs(uint64_t ticks)
+{
+    uint64_t freq = (uint64_t)s_pmOstimerFreq;
+    uint64_t us;
+
+    assert(freq != 0U);
+
+    if (freq == PM_OSTIMER_US_PER_SECOND)
+    {
+        us = ticks;
+    }
+    else
+    {
+        /* Split in whole seconds and remainder so that the multiplication cannot overflow. */
+        us = ((ticks / freq) * PM_OSTIMER_US_PER_SECOND) + (((ticks % freq) * PM_OSTIMER_US_PER_SECOND) / freq);
+    }
+
+    return us;
+}
+
+/*!
+ * brief Convert microseconds to OSTIMER ticks.
+ *
+ * param us Number of microseconds.
+ * return The number of ticks, rounded down.
+ */
+uint64_t PM_OstimerUsToTicks(uint64_t us)
+{
+    uint64_t freq = (uint64_t)s_pmOstimerFreq;
+    uint64_t ticks;
+
+    assert(freq != 0U);
+
+    if (freq == PM_OSTIMER_US_PER_SECOND)
+    {
+        ticks = us;
+    }
+    else
+    {
+        ticks = ((us / PM_OSTIMER_US_PER_SECOND) * freq) +
+                (((us % PM_OSTIMER_US_PER_SECOND) * freq) / PM_OSTIMER_US_PER_SECOND);
+    }
+
+    return ticks;
+}
+
+/*!
+ * brief Set the function called by the OSTIMER match interrupt.
+ *
+ * param callback Alarm callback, called from the interrupt context.
+ */
+void PM_OstimerSetAlarmCallback(ostimer_callback_t callback)
+{
+    s_pmOstimerAlarmCallback = callback;
+}
+
+/*!
+ * brief Arm the OSTIMER alarm.
+ *
+ * The alarm interrupt is raised by software if the counter already passed the match value.
+ *
+ * param counter Counter value of the alarm, only the bits of PM_OSTIMER_COUNTER_MASK are used.
+ */
+void PM_OstimerSetAlarm(uint64_t counter)
+{
+    assert(s_pmOstimerBase != NULL);
+
+    if (OSTIMER_SetMatchValue(s_pmOstimerBase, counter & PM_OSTIMER_COUNTER_MASK, s_pmOstimerAlarmCallback) !=
+        kStatus_Success)
+    {
+        NVIC_SetPendingIRQ(s_pmOstimerIrq);
+        (void)EnableIRQ(s_pmOstimerIrq);
+    }
+}
+
+/*!
+ * brief Disarm the OSTIMER alarm.
+ */
+void PM_OstimerCancelAlarm(void)
+{
+    assert(s_pmOstimerBase != NULL);
+
+    OSTIMER_DisableMatchInterrupt(s_pmOstimerBase);
+    (void)DisableIRQ(s_pmOstimerIrq);
+    NVIC_ClearPendingIRQ(s_pmOstimerIrq);
+}
@@ -0,0 +1,153 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_PM_OSTIMER_H_
+#define _FSL_PM_OSTIMER_H_
+
+#include "fsl_common.h"
+#include "fsl_ostimer.h"
+
+/*!
+ * @addtogroup PM Framework: Power Manager Framework
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @name OSTIMER timestamp provider
+ *
+ * Timestamp and duration functions of the timer controller built on the free-running event counter of the OSTIMER,
+ * to be registered with PM_RegisterTimerController():
+ * @code
+ * CLOCK_AttachClk(kCLK_16K2_to_OSTIMER);
+ * PM_OstimerInit(OSTIMER0, CLOCK_GetOstimerClkFreq());
+ * PM_RegisterTimerController(&g_pmHandle, timerStart, timerStop, PM_OstimerGetTimestamp, PM_OstimerGetDuration);
+ * @endcode
+ * The timestamps are counter ticks, the durations are in microseconds. The OSTIMER clock must keep running in the
+ * low power states for which the duration is measured.
+ *
+ * The match interrupt provides the alarm of the timer service, see pm_timer_service_port_t.
+ * @{
+ */
+
+/*! @brief Width of the OSTIMER event counter, the counter wraps to 0 after 2^42 ticks. */
+#define PM_OSTIMER_COUNTER_WIDTH (42U)
+
+/*! @brief Mask of the valid bits of an OSTIMER timestamp. */
+#define PM_OSTIMER_COUNTER_MASK ((1ULL << PM_OSTIMER_COUNTER_WIDTH) - 1ULL)
+
+/*! @} */
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Translate a gray-coded OSTIMER counter value to binary.
+ *
+ * Constant time alternative to OSTIMER_GrayToDecimal(), which loops once per bit when the device has no gray code
+ * decoder.
+ *
+ * @param gray The gray-coded counter value.
+ * @return The binary counter value.
+ */
+static inline uint64_t PM_OstimerGrayToBinary(uint64_t gray)
+{
+    gray ^= gray >> 1U;
+    gray ^= gray >> 2U;
+    gray ^= gray >> 4U;
+    gray ^= gray >> 8U;
+    gray ^= gray >> 16U;
+    gray ^= gray >> 32U;
+
+    return gray;
+}
+
+/*!
+ * @brief Initialize the OSTIMER used as timestamp provider.
+ *
+ * The OSTIMER clock source must be attached before calling this function.
+ *
+ * @param base OSTIMER peripheral base address.
+ * @param clockFreq Frequency of the OSTIMER clock in Hz, must not be 0.
+ */
+void PM_OstimerInit(OSTIMER_Type *base, uint32_t clockFreq);
+
+/*!
+ * @brief Get the current OSTIMER timestamp.
+ *
+ * Matches pm_low_power_timer_get_timestamp_func_t.
+ *
+ * @return The counter value in ticks, only the bits of PM_OSTIMER_COUNTER_MASK are used.
+ */
+uint64_t PM_OstimerGetTimestamp(void);
+
+/*!
+ * @brief Get the time elapsed between two OSTIMER timestamps.
+ *
+ * Matches pm_low_power_timer_get_duration_func_t. The result is correct across a wrap of the counter as long as the
+ * interval is shorter than 2^42 ticks.
+ *
+ * @param entryTimestamp The earlier timestamp.
+ * @param exitTimestamp The later timestamp.
+ * @return The elapsed time in microseconds.
+ */
+uint64_t PM_OstimerGetDuration(uint64_t entryTimestamp, uint64_t exitTimestamp);
+
+/*!
+ * @brief Convert OSTIMER ticks to microseconds.
+ *
+ * @param ticks Number of ticks.
+ * @return The number of microseconds, rounded down.
+ */
+uint64_t PM_OstimerTicksToUs(uint64_t ticks);
+
+/*!
+ * @brief Convert microseconds to OSTIMER ticks.
+ *
+ * @param us Number of microseconds.
+ * @return The number of ticks, rounded down.
+ */
+uint64_t PM_OstimerUsToTicks(uint64_t us);
+
+/*!
+ * @brief Set the function called by the OSTIMER match interrupt.
+ *
+ * @param callback Alarm callback, called from the interrupt context.
+ */
+void PM_OstimerSetAlarmCallback(ostimer_callback_t callback);
+
+/*!
+ * @brief Arm the OSTIMER alarm.
+ *
+ * The alarm interrupt is raised by software if the counter already passed the match value.
+ *
+ * @param counter Counter value of the alarm, only the bits of PM_OSTIMER_COUNTER_MASK are used.
+ */
+void PM_OstimerSetAlarm(uint64_t counter);
+
+/*!
+ * @brief Disarm the OSTIMER alarm.
+ */
+void PM_OstimerCancelAlarm(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*!
+ * @}
+ */
+
+#endif /* _FSL_PM_OSTIMER_H_ */
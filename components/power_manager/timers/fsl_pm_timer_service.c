@@ -0,0 +1,694 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include "fsl_pm_timer_service.h"
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+#define PM_TIMER_WHEEL_SLOT_MASK (PM_TIMER_WHEEL_SLOT_COUNT - 1U)
+
+#if (PM_TIMER_WHEEL_SLOT_COUNT == 32U)
+#define PM_TIMER_WHEEL_BITMAP_MASK (0xFFFFFFFFUL)
+#else
+#define PM_TIMER_WHEEL_BITMAP_MASK ((1UL << PM_TIMER_WHEEL_SLOT_COUNT) - 1UL)
+#endif /* PM_TIMER_WHEEL_SLOT_COUNT */
+
+typedef struct _pm_timer_service
+{
+    const pm_timer_service_port_t *port;
+    pm_soft_timer_t *slots[PM_TIMER_WHEEL_SLOT_COUNT];
+    uint32_t slotBitmap;   /*!< Bit n is set when slot n is not empty. */
+    uint64_t now;          /*!< Time of the last counter read. */
+    uint64_t lastCounter;  /*!< Counter value read at that time. */
+    uint64_t wheelTime;    /*!< Time of the last processing, no pending timer expires before it. */
+    uint64_t wakeTime;     /*!< Earliest deadline of the pending timers, PM_TIMER_SERVICE_NO_EXPIRY if none. */
+    bool wakeValid;        /*!< The wake time must be searched again when false. */
+    bool processing;
+    bool processAgain;    /*!< PM_TimerServiceProcess() was called while the callbacks were called. */
+    uint64_t armedExpiry; /*!< Expiry programmed in the alarm, PM_TIMER_SERVICE_NO_EXPIRY when disarmed. */
+    pm_timer_service_stats_t stats;
+} pm_timer_service_t;
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+static uint64_t PM_TimerServiceUpdateTime(void);
+static uint32_t PM_TimerServiceGetSlot(uint64_t time);
+static uint64_t PM_TimerServiceGetDeadline(const pm_soft_timer_t *timer);
+static void PM_TimerServiceLink(pm_soft_timer_t *timer);
+static void PM_TimerServiceUnlink(pm_soft_timer_t *timer);
+static uint64_t PM_TimerServiceGetWakeTime(void);
+static void PM_TimerServiceArm(uint64_t expiry);
+static void PM_TimerServiceUpdateAlarm(void);
+static pm_soft_timer_t *PM_TimerServiceCollectExpired(uint64_t now);
+static void PM_TimerServiceFire(pm_soft_timer_t *expired, uint64_t now);
+
+/*******************************************************************************
+ * Variables
+ ******************************************************************************/
+static pm_timer_service_t s_pmTimerService;
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*!
+ * @brief Read the counter of the low power timer and extend it to the 64 bits time of the service.
+ *
+ * @return The current time in ticks.
+ */
+static uint64_t PM_TimerServiceUpdateTime(void)
+{
+    uint64_t counter = s_pmTimerService.port->getCounter();
+
+    s_pmTimerService.now += (counter - s_pmTimerService.lastCounter) & s_pmTimerService.port->counterMask;
+    s_pmTimerService.lastCounter = counter;
+
+    return s_pmTimerService.now;
+}
+
+static uint32_t PM_TimerServiceGetSlot(uint64_t time)
+{
+    return (uint32_t)(time >> PM_TIMER_WHEEL_SLOT_SHIFT) & PM_TIMER_WHEEL_SLOT_MASK;
+}
+
+/*!
+ * @brief Get the latest time at which a timer may be called, its expiry plus its slack.
+ */
+static uint64_t PM_TimerServiceGetDeadline(const pm_soft_timer_t *timer)
+{
+    uint64_t deadline = PM_TIMER_SERVICE_NO_EXPIRY - 1U;
+
+    if (timer->slack < (deadline - timer->expiry))
+    {
+        deadline = timer->expiry + timer->slack;
+    }
+
+    return deadline;
+}
+
+/*!
+ * @brief Insert a timer in the slot of its expiry, to be called with the interrupts masked.
+ */
+static void PM_TimerServiceLink(pm_soft_timer_t *timer)
+{
+    uint32_t slot = PM_TimerServiceGetSlot(timer->expiry);
+
+    timer->prev = NULL;
+    timer->next = s_pmTimerService.slots[slot];
+    if (timer->next != NULL)
+    {
+        timer->next->prev = timer;
+    }
+    s_pmTimerService.slots[slot] = timer;
+    s_pmTimerService.slotBitmap |= (1UL << slot);
+    timer->state = (uint8_t)kPM_SoftTimerPending;
+
+    /* A valid wake time stays valid, an invalid one is searched again when it is needed. */
+    if (s_pmTimerService.wakeValid)
+    {
+        s_pmTimerService.wakeTime = MIN(s_pmTimerService.wakeTime, PM_TimerServiceGetDeadline(timer));
+    }
+}
+
+/*!
+ * @brief Remove a timer from its slot, to be called with the interrupts masked.
+ */
+static void PM_TimerServiceUnlink(pm_soft_timer_t *timer)
+{
+    uint32_t slot = PM_TimerServiceGetSlot(timer->expiry);
+
+    if (timer->prev != NULL)
+    {
+        timer->prev->next = timer->next;
+    }
+    else
+    {
+        s_pmTimerService.slots[slot] = timer->next;
+    }
+    if (timer->next != NULL)
+    {
+        timer->next->prev = timer->prev;
+    }
+    if (s_pmTimerService.slots[slot] == NULL)
+    {
+        s_pmTimerService.slotBitmap &= ~(1UL << slot);
+    }
+    timer->state = (uint8_t)kPM_SoftTimerIdle;
+
+    if (PM_TimerServiceGetDeadline(timer) == s_pmTimerService.wakeTime)
+    {
+        s_pmTimerService.wakeValid = false;
+    }
+}
+
+/*!
+ * @brief Get the time at which the service must run, to be called with the interrupts masked.
+ *
+ * Each timer may be called between its expiry and its deadline, its expiry plus its slack. Running at the earliest
+ * deadline calls every timer that expired by then in a single wakeup.
+ *
+ * No pending timer expires before the wheel time. The slots are visited in time order from the slot of the wheel time,
+ * the search stops at the first slot that starts after the earliest deadline found so far: the timers of this slot
+ * and of the next ones, in the current turn of the wheel or in the next turns, have later deadlines.
+ *
+ * @return The earliest deadline, PM_TIMER_SERVICE_NO_EXPIRY if no timer is pending.
+ */
+static uint64_t PM_TimerServiceGetWakeTime(void)
+{
+    uint32_t start;
+    uint32_t pending;
+    uint32_t distance;
+    uint64_t turnStart;
+    uint64_t wakeTime = PM_TIMER_SERVICE_NO_EXPIRY;
+    pm_soft_timer_t *timer;
+
+    if (!s_pmTimerService.wakeValid)
+    {
+        start     = PM_TimerServiceGetSlot(s_pmTimerService.wheelTime);
+        turnStart = (s_pmTimerService.wheelTime >> PM_TIMER_WHEEL_SLOT_SHIFT) << PM_TIMER_WHEEL_SLOT_SHIFT;
+
+        /* Rotate the bitmap so that bit n is the slot n positions after the wheel time. */
+        pending = s_pmTimerService.slotBitmap;
+        if (start != 0U)
+        {
+            pending = ((pending >> start) | (pending << (PM_TIMER_WHEEL_SLOT_COUNT - start))) &
+                      PM_TIMER_WHEEL_BITMAP_MASK;
+        }
+
+        while (pending != 0U)
+        {
+            distance = __CLZ(__RBIT(pending));
+            if (wakeTime <= (turnStart + ((uint64_t)distance << PM_TIMER_WHEEL_SLOT_SHIFT)))
+            {
+                break;
+            }
+
+            for (timer = s_pmTimerService.slots[(start + distance) & PM_TIMER_WHEEL_SLOT_MASK]; timer != NULL;
+                 timer = timer->next)
+            {
+                wakeTime = MIN(wakeTime, PM_TimerServiceGetDeadline(timer));
+            }
+            pending &= ~(1UL << distance);
+        }
+
+        s_pmTimerService.wakeTime  = wakeTime;
+        s_pmTimerService.wakeValid = true;
+    }
+
+    return s_pmTimerService.wakeTime;
+}
+
+/*!
+ * @brief Program the alarm, the hardware is only accessed when the expiry changes.
+ */
+static void PM_TimerServiceArm(uint64_t expiry)
+{
+    uint64_t delta = 0U;
+
+    if (expiry != s_pmTimerService.armedExpiry)
+    {
+        if (expiry == PM_TIMER_SERVICE_NO_EXPIRY)
+        {
+            s_pmTimerService.port->cancelAlarm();
+        }
+        else
+        {
+            /* An expiry already passed is programmed at the last counter value, the port raises the alarm at once. */
+            if (expiry > s_pmTimerService.now)
+            {
+                delta = expiry - s_pmTimerService.now;
+            }
+            s_pmTimerService.port->setAlarm((s_pmTimerService.lastCounter + delta) &
+                                            s_pmTimerService.port->counterMask);
+        }
+        s_pmTimerService.armedExpiry = expiry;
+    }
+}
+
+static void PM_TimerServiceUpdateAlarm(void)
+{
+    uint32_t regPrimask;
+
+    regPrimask = DisableGlobalIRQ();
+    PM_TimerServiceArm(PM_TimerServiceGetWakeTime());
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * @brief Remove the expired timers from the wheel, to be called with the interrupts masked.
+ *
+ * Only the slots between the last processing and now are visited, the whole wheel at most. A distinct expiry time
+ * later than the earliest one of the list only saved a wakeup if the list is processed before the deadline of the
+ * earliest expiry: otherwise the timers expired together because the processing was late, not because of the slack.
+ *
+ * @return The list of expired timers in expiry order, linked by fireNext.
+ */
+static pm_soft_timer_t *PM_TimerServiceCollectExpired(uint64_t now)
+{
+    uint64_t slotCount;
+    uint32_t slot;
+    pm_soft_timer_t *timer;
+    pm_soft_timer_t *next;
+    pm_soft_timer_t *expired = NULL;
+    pm_soft_timer_t **link;
+    bool onTime;
+
+    slotCount = (now >> PM_TIMER_WHEEL_SLOT_SHIFT) - (s_pmTimerService.wheelTime >> PM_TIMER_WHEEL_SLOT_SHIFT) + 1U;
+    if (slotCount > (uint64_t)PM_TIMER_WHEEL_SLOT_COUNT)
+    {
+        slotCount = (uint64_t)PM_TIMER_WHEEL_SLOT_COUNT;
+    }
+
+    slot = PM_TimerServiceGetSlot(s_pmTimerService.wheelTime);
+    while (slotCount > 0U)
+    {
+        for (timer = s_pmTimerService.slots[slot]; timer != NULL; timer = next)
+        {
+            next = timer->next;
+            if (timer->expiry <= now)
+            {
+                PM_TimerServiceUnlink(timer);
+                timer->state = (uint8_t)kPM_SoftTimerFiring;
+                for (link = &expired; (*link != NULL) && ((*link)->expiry <= timer->expiry); link = &(*link)->fireNext)
+                {
+                }
+                timer->fireNext = *link;
+                *link           = timer;
+            }
+        }
+        slot = (slot + 1U) & PM_TIMER_WHEEL_SLOT_MASK;
+        slotCount--;
+    }
+
+    s_pmTimerService.wheelTime = now;
+
+    if (expired != NULL)
+    {
+        onTime = (now <= PM_TimerServiceGetDeadline(expired));
+        s_pmTimerService.stats.wakeups++;
+        for (timer = expired; timer != NULL; timer = timer->fireNext)
+        {
+            if ((timer->fireNext == NULL) || (timer->fireNext->expiry != timer->expiry))
+            {
+                s_pmTimerService.stats.expiries++;
+                if (onTime && (timer->expiry != expired->expiry))
+                {
+                    s_pmTimerService.stats.savedWakeups++;
+                }
+            }
+        }
+    }
+
+    return expired;
+}
+
+/*!
+ * @brief Call the callbacks of the expired timers.
+ *
+ * A timer restarted or cancelled by an earlier callback of the list is not in the firing state anymore, and is
+ * skipped. Periodic timers are inserted again before their callback, which may then cancel them.
+ */
+static void PM_TimerServiceFire(pm_soft_timer_t *expired, uint64_t now)
+{
+    uint32_t regPrimask;
+    uint64_t late;
+    pm_soft_timer_t *timer;
+    pm_soft_timer_t *next;
+    bool fire;
+
+    for (timer = expired; timer != NULL; timer = next)
+    {
+        regPrimask = DisableGlobalIRQ();
+        next       = timer->fireNext;
+        fire       = (timer->state == (uint8_t)kPM_SoftTimerFiring);
+        if (fire)
+        {
+            if (timer->period != 0U)
+            {
+                timer->expiry += timer->period;
+                if (timer->expiry <= now)
+                {
+                    late = now - timer->expiry;
+                    timer->expiry += ((late / timer->period) + 1U) * timer->period;
+                }
+                PM_TimerServiceLink(timer);
+            }
+            else
+            {
+                timer->state = (uint8_t)kPM_SoftTimerIdle;
+            }
+        }
+        EnableGlobalIRQ(regPrimask);
+
+        if (fire && (timer->callback != NULL))
+        {
+            timer->callback(timer->param);
+        }
+    }
+}
+
+/*!
+ * brief Initialize the timer service.
+ *
+ * param port The low power timer used by the service, must stay valid while the service is used.
+ */
+void PM_TimerServiceInit(const pm_timer_service_port_t *port)
+{
+    assert(port != NULL);
+    assert((port->getCounter != NULL) && (port->setAlarm != NULL) && (port->cancelAlarm != NULL));
+
+    (void)memset(&s_pmTimerService, 0, sizeof(s_pmTimerService));
+    s_pmTimerService.port        = port;
+    s_pmTimerService.lastCounter = port->getCounter();
+    s_pmTimerService.wakeTime    = PM_TIMER_SERVICE_NO_EXPIRY;
+    s_pmTimerService.wakeValid   = true;
+    s_pmTimerService.armedExpiry = PM_TIMER_SERVICE_NO_EXPIRY;
+}
+
+/*!
+ * brief Initialize a software timer.
+ *
+ * param timer Pointer to the timer.
+ * param callback Function called when the timer expires.
+ * param param Parameter passed to the callback.
+ */
+void PM_SoftTimerInit(pm_soft_timer_t *timer, pm_soft_timer_callback_t callback, void *param)
+{
+    assert(timer != NULL);
+
+    (void)memset(timer, 0, sizeof(*timer));
+    timer->callback = callback;
+    timer->param    = param;
+}
+
+/*!
+ * brief Start a software timer, or restart it if it is already started.
+ *
+ * Periodic timers keep their phase: when the callback is late by more than one period, the missed periods are
+ * skipped.
+ *
+ * param timer Pointer to the timer.
+ * param timeout Time until the first expiry, in ticks.
+ * param period Period in ticks, 0 for a one-shot timer.
+ */
+void PM_SoftTimerStart(pm_soft_timer_t *timer, uint64_t timeout, uint64_t period)
+{
+    uint32_t regPrimask;
+
+    assert(timer != NULL);
+    assert(s_pmTimerService.port != NULL);
+
+    regPrimask = DisableGlobalIRQ();
+    if (timer->state == (uint8_t)kPM_SoftTimerPending)
+    {
+        PM_TimerServiceUnlink(timer);
+    }
+    timer->period = period;
+    timer->expiry = PM_TimerServiceUpdateTime() + timeout;
+    PM_TimerServiceLink(timer);
+    EnableGlobalIRQ(regPrimask);
+
+    PM_TimerServiceUpdateAlarm();
+}
+
+/*!
+ * brief Cancel a software timer.
+ *
+ * The callback is not called after this function returns, unless it is already running.
+ *
+ * param timer Pointer to the timer.
+ */
+void PM_SoftTimerCancel(pm_soft_timer_t *timer)
+{
+    uint32_t regPrimask;
+
+    assert(timer != NULL);
+
+    regPrimask = DisableGlobalIRQ();
+    if (timer->state == (uint8_t)kPM_SoftTimerPending)
+    {
+        PM_TimerServiceUnlink(timer);
+    }
+    timer->state = (uint8_t)kPM_SoftTimerIdle;
+    EnableGlobalIRQ(regPrimask);
+
+    PM_TimerServiceUpdateAlarm();
+}
+
+/*!
+ * brief Set the slack of a software timer.
+ *
+ * The callback may be called up to slack ticks after the expiry, together with the other timers expiring in that
+ * window. The default slack is 0.
+ *
+ * param timer Pointer to the timer.
+ * param slack Slack in ticks.
+ */
+void PM_SoftTimerSetSlack(pm_soft_timer_t *timer, uint64_t slack)
+{
+    uint32_t regPrimask;
+
+    assert(timer != NULL);
+
+    regPrimask = DisableGlobalIRQ();
+    if (timer->state == (uint8_t)kPM_SoftTimerPending)
+    {
+        /* Move the timer to its new deadline. */
+        PM_TimerServiceUnlink(timer);
+        timer->slack = slack;
+        PM_TimerServiceLink(timer);
+    }
+    else
+    {
+        timer->slack = slack;
+    }
+    EnableGlobalIRQ(regPrimask);
+
+    PM_TimerServiceUpdateAlarm();
+}
+
+/*!
+ * brief Check whether a software timer is started.
+ *
+ * param timer Pointer to the timer.
+ * return true if the timer is started and did not expire, or if it is periodic.
+ */
+bool PM_SoftTimerIsActive(const pm_soft_timer_t *timer)
+{
+    assert(timer != NULL);
+
+    return (timer->state != (uint8_t)kPM_SoftTimerIdle);
+}
+
+/*!
+ * brief Get the current time of the timer service.
+ *
+ * The counter of the low power timer extended to 64 bits. The service must read the counter at least once per wrap,
+ * which is the case as long as a timer is started.
+ *
+ * return The current time in ticks.
+ */
+uint64_t PM_TimerServiceGetTime(void)
+{
+    uint32_t regPrimask;
+    uint64_t now;
+
+    regPrimask = DisableGlobalIRQ();
+    now        = PM_TimerServiceUpdateTime();
+    EnableGlobalIRQ(regPrimask);
+
+    return now;
+}
+
+/*!
+ * brief Get the time of the next wakeup of the timer service.
+ *
+ * The earliest deadline of the started timers, which is the earliest expiry when the timers have no slack.
+ *
+ * return The wakeup time in ticks, PM_TIMER_SERVICE_NO_EXPIRY if no timer is started.
+ */
+uint64_t PM_TimerServiceGetNextExpiry(void)
+{
+    uint32_t regPrimask;
+    uint64_t wakeTime;
+
+    regPrimask = DisableGlobalIRQ();
+    wakeTime   = PM_TimerServiceGetWakeTime();
+    EnableGlobalIRQ(regPrimask);
+
+    return wakeTime;
+}
+
+/*!
+ * brief Get the wakeup statistics of the timer service.
+ *
+ * param stats Pointer to the statistics to fill.
+ */
+void PM_TimerServiceGetStats(pm_timer_service_stats_t *stats)
+{
+    uint32_t regPrimask;
+
+    assert(stats != NULL);
+
+    regPrimask = DisableGlobalIRQ();
+    *stats     = s_pmTimerService.stats;
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Reset the wakeup statistics of the timer service.
+ */
+void PM_TimerServiceResetStats(void)
+{
+    uint32_t regPrimask;
+
+    regPrimask = DisableGlobalIRQ();
+    (void)memset(&s_pmTimerService.stats, 0, sizeof(s_pmTimerService.stats));
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Call the callbacks of the expired software timers, and program the alarm of the next one.
+ *
+ * Called from thread context by PM_TimerServiceIdle(). A call that interrupts another one is deferred to the
+ * interrupted call.
+ */
+void PM_TimerServiceProcess(void)
+{
+    uint32_t regPrimask;
+    uint64_t now;
+    pm_soft_timer_t *expired;
+    bool process;
+
+    assert(s_pmTimerService.port != NULL);
+
+    regPrimask = DisableGlobalIRQ();
+    process    = !s_pmTimerService.processing;
+    if (process)
+    {
+        s_pmTimerService.processing = true;
+    }
+    else
+    {
+        s_pmTimerService.processAgain = true;
+    }
+    EnableGlobalIRQ(regPrimask);
+
+    while (process)
+    {
+        regPrimask                    = DisableGlobalIRQ();
+        s_pmTimerService.processAgain = false;
+        now                           = PM_TimerServiceUpdateTime();
+        expired                       = PM_TimerServiceCollectExpired(now);
+        EnableGlobalIRQ(regPrimask);
+
+        PM_TimerServiceFire(expired, now);
+
+        regPrimask = DisableGlobalIRQ();
+        process    = s_pmTimerService.processAgain;
+        if (!process)
+        {
+            s_pmTimerService.processing = false;
+            PM_TimerServiceArm(PM_TimerServiceGetWakeTime());
+        }
+        EnableGlobalIRQ(regPrimask);
+    }
+}
+
+/*!
+ * brief Handle the alarm interrupt of the low power timer.
+ *
+ * To be called from the alarm interrupt handler, the expired timers are processed in the interrupt context.
+ */
+void PM_TimerServiceHandleAlarm(void)
+{
+    uint32_t regPrimask;
+
+    /* The alarm is one-shot, it must be programmed again even if the next expiry is the same. */
+    regPrimask                   = DisableGlobalIRQ();
+    s_pmTimerService.armedExpiry = PM_TIMER_SERVICE_NO_EXPIRY;
+    EnableGlobalIRQ(regPrimask);
+
+    PM_TimerServiceProcess();
+}
+
+/*!
+ * brief Start the low power timer for the power manager.
+ *
+ * Matches pm_low_power_timer_start_func_t. The alarm is programmed at the earliest of the timeout and the next
+ * software timer, so that a timer started just before the low power entry still wakes up the device.
+ *
+ * param timeout Duration in ticks.
+ */
+void PM_TimerServiceTimerStart(uint64_t timeout)
+{
+    uint32_t regPrimask;
+    uint64_t now;
+    uint64_t expiry = PM_TIMER_SERVICE_NO_EXPIRY;
+
+    regPrimask = DisableGlobalIRQ();
+    now        = PM_TimerServiceUpdateTime();
+    /* A duration that wrapped below 0 means no timeout. */
+    if (timeout < (PM_TIMER_SERVICE_NO_EXPIRY - now))
+    {
+        expiry = now + timeout;
+    }
+    PM_TimerServiceArm(MIN(expiry, PM_TimerServiceGetWakeTime()));
+    EnableGlobalIRQ(regPrimask);
+}
+
+/*!
+ * brief Stop the low power timer for the power manager.
+ *
+ * Matches pm_low_power_timer_stop_func_t. The alarm of the next software timer is programmed again if needed.
+ */
+void PM_TimerServiceTimerStop(void)
+{
+    PM_TimerServiceUpdateAlarm();
+}
+
+/*!
+ * brief Process the expired software timers and enter the low power mode until the next one.
+ *
+ * To be called from the idle loop. The low power mode is entered with no duration limit when no timer is started,
+ * and not entered at all when a timer expired in the meantime.
+ */
+void PM_TimerServiceIdle(void)
+{
+    uint32_t regPrimask;
+    uint64_t now;
+    uint64_t wakeTime;
+    uint64_t duration = 0U;
+    bool expired      = false;
+
+    PM_TimerServiceProcess();
+
+    regPrimask = DisableGlobalIRQ();
+    now        = PM_TimerServiceUpdateTime();
+    wakeTime   = PM_TimerServiceGetWakeTime();
+    if (wakeTime != PM_TIMER_SERVICE_NO_EXPIRY)
+    {
+        if (wakeTime > now)
+        {
+            duration = wakeTime - now;
+        }
+        else
+        {
+            expired = true;
+        }
+    }
+    EnableGlobalIRQ(regPrimask);
+
+    if (!expired)
+    {
+        PM_EnterLowPower(duration);
+    }
+
+    PM_TimerServiceProcess();
+}
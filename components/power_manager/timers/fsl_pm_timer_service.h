@@ -0,0 +1,283 @@
+/*
+ * Copyright 2023 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef _FSL_PM_TIMER_SERVICE_H_
+#define _FSL_PM_TIMER_SERVICE_H_
+
+#include "fsl_common.h"
+#include "fsl_pm_core.h"
+
+/*!
+ * @addtogroup PM Framework: Power Manager Framework
+ * @{
+ */
+
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*!
+ * @name Timer service
+ *
+ * Software timers multiplexed on the one-shot alarm of a single free-running low power timer. The timers are kept in a
+ * hashed timer wheel: starting and cancelling a timer take a constant time, only the alarm of the earliest timer is
+ * programmed in the hardware.
+ *
+ * A timer with a slack may be called up to slack ticks after its expiry. The service wakes up at the earliest deadline,
+ * expiry plus slack, of the started timers and calls every timer that expired by then: the expiries that fall within
+ * each other's slack are coalesced in one wakeup, and the idle periods get longer.
+ *
+ * PM_TimerServiceIdle() enters the low power mode for the time left until the next wakeup, so the application does
+ * not compute the duration itself. The service also provides the start and stop functions of the timer controller:
+ * @code
+ * static const pm_timer_service_port_t s_timerPort = {
+ *     .getCounter  = PM_OstimerGetTimestamp,
+ *     .counterMask = PM_OSTIMER_COUNTER_MASK,
+ *     .setAlarm    = PM_OstimerSetAlarm,
+ *     .cancelAlarm = PM_OstimerCancelAlarm,
+ * };
+ *
+ * PM_OstimerInit(OSTIMER0, CLOCK_GetOstimerClkFreq());
+ * PM_OstimerSetAlarmCallback(PM_TimerServiceHandleAlarm);
+ * PM_TimerServiceInit(&s_timerPort);
+ * PM_RegisterTimerController(&g_pmHandle, PM_TimerServiceTimerStart, PM_TimerServiceTimerStop,
+ *                            PM_OstimerGetTimestamp, PM_OstimerGetDuration);
+ *
+ * while (true)
+ * {
+ *     PM_TimerServiceIdle();
+ * }
+ * @endcode
+ * All the times are in ticks of the low power timer. When FSL_PM_SUPPORT_TIME_BASE is enabled, the time base registered
+ * to the power manager must use the frequency of this timer.
+ * @{
+ */
+
+#ifndef PM_TIMER_WHEEL_SLOT_COUNT
+/*! @brief Number of slots of the timer wheel, a power of 2 not larger than 32. */
+#define PM_TIMER_WHEEL_SLOT_COUNT (32U)
+#endif /* PM_TIMER_WHEEL_SLOT_COUNT */
+
+#ifndef PM_TIMER_WHEEL_SLOT_SHIFT
+/*!
+ * @brief Time covered by one slot of the timer wheel, as a power of 2 of the ticks.
+ *
+ * The next wakeup is found quickly when most timers expire within one turn of the wheel. The default turn lasts
+ * 1 second with a 16384Hz timer.
+ */
+#define PM_TIMER_WHEEL_SLOT_SHIFT (9U)
+#endif /* PM_TIMER_WHEEL_SLOT_SHIFT */
+
+#if ((PM_TIMER_WHEEL_SLOT_COUNT > 32U) || (PM_TIMER_WHEEL_SLOT_COUNT == 0U) || \
+     ((PM_TIMER_WHEEL_SLOT_COUNT & (PM_TIMER_WHEEL_SLOT_COUNT - 1U)) != 0U))
+#error "PM_TIMER_WHEEL_SLOT_COUNT must be a power of 2 not larger than 32."
+#endif
+
+/*! @brief Expiry returned when no timer is pending. */
+#define PM_TIMER_SERVICE_NO_EXPIRY (UINT64_MAX)
+
+/*! @} */
+
+/*!
+ * @brief Software timer state.
+ */
+typedef enum _pm_soft_timer_state
+{
+    kPM_SoftTimerIdle = 0U, /*!< The timer is not started. */
+    kPM_SoftTimerPending,   /*!< The timer is in the timer wheel. */
+    kPM_SoftTimerFiring,    /*!< The timer expired and its callback is about to be called. */
+} pm_soft_timer_state_t;
+
+/*!
+ * @brief Software timer callback, called from the context of PM_TimerServiceProcess().
+ */
+typedef void (*pm_soft_timer_callback_t)(void *param);
+
+/*!
+ * @brief Software timer, the memory is provided by the application and must stay valid while the timer is started.
+ */
+typedef struct _pm_soft_timer
+{
+    struct _pm_soft_timer *next;     /*!< Next timer of the same wheel slot. */
+    struct _pm_soft_timer *prev;     /*!< Previous timer of the same wheel slot. */
+    struct _pm_soft_timer *fireNext; /*!< Next expired timer, while the callbacks are called. */
+    uint64_t expiry;                 /*!< Expiry time in ticks. */
+    uint64_t period;                 /*!< Period in ticks, 0 for a one-shot timer. */
+    uint64_t slack;                  /*!< Delay in ticks tolerated after the expiry. */
+    pm_soft_timer_callback_t callback;
+    void *param;
+    uint8_t state; /*!< One of pm_soft_timer_state_t. */
+} pm_soft_timer_t;
+
+/*!
+ * @brief Low power timer used by the timer service.
+ */
+typedef struct _pm_timer_service_port
+{
+    uint64_t (*getCounter)(void); /*!< Read the free-running counter of the timer. */
+    uint64_t counterMask;         /*!< Valid bits of the counter, the counter wraps to 0 after this value. */
+    void (*setAlarm)(uint64_t counter); /*!< Arm the one-shot alarm at a counter value. The alarm interrupt must call
+                                             PM_TimerServiceHandleAlarm(), immediately if the counter already passed
+                                             the value. */
+    void (*cancelAlarm)(void);          /*!< Disarm the alarm. */
+} pm_timer_service_port_t;
+
+/*!
+ * @brief Wakeup statistics of the timer service.
+ */
+typedef struct _pm_timer_service_stats
+{
+    uint32_t wakeups;      /*!< Number of times expired timers were called. */
+    uint32_t expiries;     /*!< Number of distinct expiry times called, the wakeups needed without slack. */
+    uint32_t savedWakeups; /*!< Expiry times called in the wakeup of an earlier expiry thanks to the slack, not
+                                    counting the timers expired together because the processing was late. */
+} pm_timer_service_stats_t;
+
+/*******************************************************************************
+ * APIs
+ ******************************************************************************/
+
+#if defined(__cplusplus)
+extern "C" {
+#endif /* __cplusplus */
+
+/*!
+ * @brief Initialize the timer service.
+ *
+ * @param port The low power timer used by the service, must stay valid while the service is used.
+ */
+void PM_TimerServiceInit(const pm_timer_service_port_t *port);
+
+/*!
+ * @brief Initialize a software timer.
+ *
+ * @param timer Pointer to the timer.
+ * @param callback Function called when the timer expires.
+ * @param param Parameter passed to the callback.
+ */
+void PM_SoftTimerInit(pm_soft_timer_t *timer, pm_soft_timer_callback_t callback, void *param);
+
+/*!
+ * @brief Start a software timer, or restart it if it is already started.
+ *
+ * Periodic timers keep their phase: when the callback is late by more than one period, the missed periods are
+ * skipped.
+ *
+ * @param timer Pointer to the timer.
+ * @param timeout Time until the first expiry, in ticks.
+ * @param period Period in ticks, 0 for a one-shot timer.
+ */
+void PM_SoftTimerStart(pm_soft_timer_t *timer, uint64_t timeout, uint64_t period);
+
+/*!
+ * @brief Cancel a software timer.
+ *
+ * The callback is not called after this function returns, unless it is already running.
+ *
+ * @param timer Pointer to the timer.
+ */
+void PM_SoftTimerCancel(pm_soft_timer_t *timer);
+
+/*!
+ * @brief Set the slack of a software timer.
+ *
+ * The callback may be called up to slack ticks after the expiry, together with the other timers expiring in that
+ * window. The default slack is 0.
+ *
+ * @param timer Pointer to the timer.
+ * @param slack Slack in ticks.
+ */
+void PM_SoftTimerSetSlack(pm_soft_timer_t *timer, uint64_t slack);
+
+/*!
+ * @brief Check whether a software timer is started.
+ *
+ * @param timer Pointer to the timer.
+ * @return true if the timer is started and did not expire, or if it is periodic.
+ */
+bool PM_SoftTimerIsActive(const pm_soft_timer_t *timer);
+
+/*!
+ * @brief Get the current time of the timer service.
+ *
+ * The counter of the low power timer extended to 64 bits. The service must read the counter at least once per wrap,
+ * which is the case as long as a timer is started.
+ *
+ * @return The current time in ticks.
+ */
+uint64_t PM_TimerServiceGetTime(void);
+
+/*!
+ * @brief Get the time of the next wakeup of the timer service.
+ *
+ * The earliest deadline of the started timers, which is the earliest expiry when the timers have no slack.
+ *
+ * @return The wakeup time in ticks, PM_TIMER_SERVICE_NO_EXPIRY if no timer is started.
+ */
+uint64_t PM_TimerServiceGetNextExpiry(void);
+
+/*!
+ * @brief Get the wakeup statistics of the timer service.
+ *
+ * @param stats Pointer to the statistics to fill.
+ */
+void PM_TimerServiceGetStats(pm_timer_service_stats_t *stats);
+
+/*!
+ * @brief Reset the wakeup statistics of the timer service.
+ */
+void PM_TimerServiceResetStats(void);
+
+/*!
+ * @brief Call the callbacks of the expired software timers, and program the alarm of the next one.
+ *
+ * Called from thread context by PM_TimerServiceIdle(). A call that interrupts another one is deferred to the
+ * interrupted call.
+ */
+void PM_TimerServiceProcess(void);
+
+/*!
+ * @brief Handle the alarm interrupt of the low power timer.
+ *
+ * To be called from the alarm interrupt handler, the expired timers are processed in the interrupt context.
+ */
+void PM_TimerServiceHandleAlarm(void);
+
+/*!
+ * @brief Start the low power timer for the power manager.
+ *
+ * Matches pm_low_power_timer_start_func_t. The alarm is programmed at the earliest of the timeout and the next
+ * software timer, so that a timer started just before the low power entry still wakes up the device.
+ *
+ * @param timeout Duration in ticks.
+ */
+void PM_TimerServiceTimerStart(uint64_t timeout);
+
+/*!
+ * @brief Stop the low power timer for the power manager.
+ *
+ * Matches pm_low_power_timer_stop_func_t. The alarm of the next software timer is programmed again if needed.
+ */
+void PM_TimerServiceTimerStop(void);
+
+/*!
+ * @brief Process the expired software timers and enter the low power mode until the next one.
+ *
+ * To be called from the idle loop. The low power mode is entered with no duration limit when no timer is started,
+ * and not entered at all when a timer expired in the meantime.
+ */
+void PM_TimerServiceIdle(void);
+
+#if defined(__cplusplus)
+}
+#endif /* __cplusplus */
+
+/*!
+ * @}
+ */
+
+#endif /* _FSL_PM_TIMER_SERVICE_H_ */
@@ -524,6 +524,27 @@
 #  # description: Component power_manager
 #  set(CONFIG_USE_component_power_manager true)
 
+#  # description: Component power_manager OSTIMER timestamp provider
+#  set(CONFIG_USE_component_power_manager_ostimer true)
+
+#  # description: Component power_manager LPTMR low power timer
+#  set(CONFIG_USE_component_power_manager_lptmr true)
+
+#  # description: Component power_manager timer service
+#  set(CONFIG_USE_component_power_manager_timer_service true)
+
+#  # description: Component power_manager FreeRTOS tickless idle
+#  set(CONFIG_USE_component_power_manager_freertos true)
+
+#  # description: Component power_manager event loop
+#  set(CONFIG_USE_component_power_manager_event_loop true)
+
+#  # description: Component power_manager multicore
+#  set(CONFIG_USE_component_power_manager_multicore true)
+
+#  # description: Component power_manager C++ binding
+#  set(CONFIG_USE_component_power_manager_cpp true)
+
 #  # description: Component led
 #  set(CONFIG_USE_component_led true)
 
@@ -2149,6 +2170,13 @@ include_if_use(component_i3c_bus_adapter.MCXN947)
 include_if_use(component_led.MCXN947)
 include_if_use(component_lists.MCXN947)
 include_if_use(component_power_manager.MCXN947)
+include_if_use(component_power_manager_ostimer.MCXN947)
+include_if_use(component_power_manager_lptmr.MCXN947)
+include_if_use(component_power_manager_timer_service.MCXN947)
+include_if_use(component_power_manager_freertos.MCXN947)
+include_if_use(component_power_manager_event_loop.MCXN947)
+include_if_use(component_power_manager_multicore.MCXN947)
+include_if_use(component_power_manager_cpp.MCXN947)
 include_if_use(component_log.MCXN947)
 include_if_use(component_log_backend_debugconsole.MCXN947)
 include_if_use(component_log_backend_debugconsole_lite.MCXN947)